@@ -7,6 +7,7 @@ namespace binser {
     namespace polices {
         struct StaticStoragePolicy;
         struct DynamicStoragePolicy;
+        struct SegmentedStoragePolicy;
 
         namespace traits {
             template<typename T>
@@ -24,14 +25,29 @@ namespace binser {
             template<>
             struct is_static_v<StaticStoragePolicy> : std::true_type {
             };
+
+            template<typename T>
+            struct is_segmented_v : std::false_type {
+            };
+
+            template<>
+            struct is_segmented_v<SegmentedStoragePolicy> : std::true_type {
+            };
         }
 
+        struct SegmentList {
+            std::vector<std::unique_ptr<char[]>> chunks;
+        };
+
         template<typename Derived>
         struct IStorage {
             IStorage() {
                 if constexpr (traits::is_static_v<Derived>::value) {
                     bytes.staticStorage = {};
                     control.staticControlBlock = {0, 0};
+                } else if constexpr (traits::is_segmented_v<Derived>::value) {
+                    control.segmentedControlBlock = {0, 0};
+                    bytes.segmentedStorage = new SegmentList{};
                 } else {
                     control.dynamicControlBlock = {0, 4, 0};
                     bytes.dynamicStorage = new char[control.dynamicControlBlock.logSz];
@@ -41,12 +57,14 @@ namespace binser {
             ~IStorage() {
                 if constexpr (traits::is_dynamic_v<Derived>::value) {
                     delete[] bytes.dynamicStorage;
+                } else if constexpr (traits::is_segmented_v<Derived>::value) {
+                    delete bytes.segmentedStorage;
                 }
             }
 
             template<typename T>
-            void read(const T &elem) {
-                (static_cast<Derived *>(this))->readImpl((char *) &elem, sizeof(T));
+            bool read(const T &elem) {
+                return (static_cast<Derived *>(this))->readImpl((char *) &elem, sizeof(T));
             }
 
             template<typename T>
@@ -54,6 +72,136 @@ namespace binser {
                 (static_cast<Derived *>(this))->writeImpl((char *) &out, sizeof(T));
             }
 
+            bool readBytes(char *elem, std::size_t sz) {
+                return (static_cast<Derived *>(this))->readImpl(elem, sz);
+            }
+
+            void writeBytes(const char *out, std::size_t sz) {
+                (static_cast<Derived *>(this))->writeImpl(out, sz);
+            }
+
+            bool skipBytes(std::size_t sz) {
+                return (static_cast<Derived *>(this))->skipImpl(sz);
+            }
+
+            // Only contiguous policies have a data() pointer; use forEachSpan(),
+            // peekBytes() and patchBytes() for code that must work with all of them.
+            char *data() {
+                static_assert(!traits::is_segmented_v<Derived>::value, "Segmented storage is not contiguous !");
+                if constexpr (traits::is_static_v<Derived>::value) {
+                    return bytes.staticStorage.data();
+                } else {
+                    return bytes.dynamicStorage;
+                }
+            }
+
+            // Calls fn(char *, std::size_t) for each contiguous span of [offset, offset + len).
+            template<typename F>
+            void forEachSpan(std::size_t offset, std::size_t len, F &&fn) {
+                if constexpr (traits::is_segmented_v<Derived>::value) {
+                    constexpr std::size_t segmentSize = Derived::segmentSize;
+                    auto &chunks = bytes.segmentedStorage->chunks;
+
+                    while (len > 0) {
+                        std::size_t inChunk = offset % segmentSize;
+                        std::size_t n = std::min(len, segmentSize - inChunk);
+                        fn(chunks[offset / segmentSize].get() + inChunk, n);
+                        offset += n;
+                        len -= n;
+                    }
+                } else if (len > 0) {
+                    fn(data() + offset, len);
+                }
+            }
+
+            void peekBytes(std::size_t offset, char *out, std::size_t sz) {
+                forEachSpan(offset, sz, [&out](const char *span, std::size_t n) {
+                    std::memcpy(out, span, n);
+                    out += n;
+                });
+            }
+
+            void patchBytes(std::size_t offset, const char *in, std::size_t sz) {
+                forEachSpan(offset, sz, [&in](char *span, std::size_t n) {
+                    std::memcpy(span, in, n);
+                    in += n;
+                });
+            }
+
+#ifdef BINSER_HAS_IOVEC
+            // The written bytes as an iovec array, e.g. for writev(); one entry per
+            // segment for segmented storage.
+            std::vector<iovec> iovecs() {
+                std::vector<iovec> out;
+                forEachSpan(0, size(), [&out](char *span, std::size_t n) {
+                    out.push_back(iovec{span, n});
+                });
+                return out;
+            }
+#endif
+
+            [[nodiscard]] std::size_t size() const {
+                if constexpr (traits::is_static_v<Derived>::value) {
+                    return control.staticControlBlock.writeIdx;
+                } else if constexpr (traits::is_segmented_v<Derived>::value) {
+                    return control.segmentedControlBlock.phySz;
+                } else {
+                    return control.dynamicControlBlock.phySz;
+                }
+            }
+
+            [[nodiscard]] std::size_t capacity() const {
+                if constexpr (traits::is_static_v<Derived>::value) {
+                    return bytes.staticStorage.size();
+                } else if constexpr (traits::is_segmented_v<Derived>::value) {
+                    return bytes.segmentedStorage->chunks.size() * Derived::segmentSize;
+                } else {
+                    return control.dynamicControlBlock.logSz;
+                }
+            }
+
+            [[nodiscard]] std::size_t readOffset() const {
+                if constexpr (traits::is_static_v<Derived>::value) {
+                    return control.staticControlBlock.readIdx;
+                } else if constexpr (traits::is_segmented_v<Derived>::value) {
+                    return control.segmentedControlBlock.readIdx;
+                } else {
+                    return control.dynamicControlBlock.readIdx;
+                }
+            }
+
+            // Moves the read position to an absolute offset within the written bytes.
+            bool seekRead(std::size_t offset) {
+                if (offset > size()) {
+                    return false;
+                }
+
+                if constexpr (traits::is_static_v<Derived>::value) {
+                    control.staticControlBlock.readIdx = offset;
+                } else if constexpr (traits::is_segmented_v<Derived>::value) {
+                    control.segmentedControlBlock.readIdx = offset;
+                } else {
+                    control.dynamicControlBlock.readIdx = offset;
+                }
+                return true;
+            }
+
+            // Forgets all written bytes but keeps the allocated storage.
+            void clear() {
+                if constexpr (traits::is_static_v<Derived>::value) {
+                    control.staticControlBlock = {0, 0};
+                } else if constexpr (traits::is_segmented_v<Derived>::value) {
+                    control.segmentedControlBlock = {0, 0};
+                } else {
+                    control.dynamicControlBlock.phySz = 0;
+                    control.dynamicControlBlock.readIdx = 0;
+                }
+            }
+
+            [[nodiscard]] std::size_t remaining() const {
+                return size() > readOffset() ? size() - readOffset() : 0;
+            }
+
 
             union ControlBlock {
                 struct StaticControlBlock {
@@ -66,87 +214,1016 @@ namespace binser {
                     std::size_t logSz;
                     std::size_t readIdx;
                 } dynamicControlBlock;
+
+                struct SegmentedControlBlock {
+                    std::size_t phySz;
+                    std::size_t readIdx;
+                } segmentedControlBlock;
             };
 
             union Storage {
                 std::array<char, 1024> staticStorage;
                 char *dynamicStorage;
+                SegmentList *segmentedStorage;
             };
 
             ControlBlock control;
             Storage bytes;
         };
 
-        struct StaticStoragePolicy : IStorage<StaticStoragePolicy> {
-            using storage_type = IStorage<StaticStoragePolicy>;
+        struct StaticStoragePolicy : IStorage<StaticStoragePolicy> {
+            using storage_type = IStorage<StaticStoragePolicy>;
+
+            bool readImpl(char *elem, std::size_t sz) {
+                if (sz > storage_type::control.staticControlBlock.writeIdx -
+                         storage_type::control.staticControlBlock.readIdx) {
+                    return false;
+                }
+
+                std::memcpy(elem,
+                            storage_type::bytes.staticStorage.data() + storage_type::control.staticControlBlock.readIdx,
+                            sz);
+                storage_type::control.staticControlBlock.readIdx += sz;
+                return true;
+            }
+
+            bool skipImpl(std::size_t sz) {
+                if (sz > storage_type::control.staticControlBlock.writeIdx -
+                         storage_type::control.staticControlBlock.readIdx) {
+                    return false;
+                }
+
+                storage_type::control.staticControlBlock.readIdx += sz;
+                return true;
+            }
+
+            void writeImpl(const char *out, std::size_t sz) {
+                std::memcpy(
+                        storage_type::bytes.staticStorage.data() + storage_type::control.staticControlBlock.writeIdx,
+                        out, sz);
+                storage_type::control.staticControlBlock.writeIdx += sz;
+            }
+        };
+
+        struct DynamicStoragePolicy : IStorage<DynamicStoragePolicy> {
+            using storage_type = IStorage<DynamicStoragePolicy>;
+
+            bool readImpl(char *elem, std::size_t sz) {
+                if (sz > storage_type::control.dynamicControlBlock.phySz -
+                         storage_type::control.dynamicControlBlock.readIdx) {
+                    return false;
+                }
+
+                std::memcpy(elem,
+                            storage_type::bytes.dynamicStorage + storage_type::control.dynamicControlBlock.readIdx,
+                            sz);
+                storage_type::control.dynamicControlBlock.readIdx += sz;
+                return true;
+            }
+
+            bool skipImpl(std::size_t sz) {
+                if (sz > storage_type::control.dynamicControlBlock.phySz -
+                         storage_type::control.dynamicControlBlock.readIdx) {
+                    return false;
+                }
+
+                storage_type::control.dynamicControlBlock.readIdx += sz;
+                return true;
+            }
+
+            void writeImpl(const char *out, std::size_t sz) {
+                if (storage_type::control.dynamicControlBlock.phySz + sz >=
+                    storage_type::control.dynamicControlBlock.logSz
+                        ) {
+                    while (storage_type::control.dynamicControlBlock.phySz + sz >=
+                           storage_type::control.dynamicControlBlock.logSz) {
+                        storage_type::control.dynamicControlBlock.logSz *= 2;
+                    }
+                    auto *oldBytes = storage_type::bytes.dynamicStorage;
+                    storage_type::bytes.dynamicStorage = new char[storage_type::control.dynamicControlBlock.logSz];
+                    std::memcpy(storage_type::bytes.dynamicStorage, oldBytes,
+                                storage_type::control.dynamicControlBlock.phySz);
+                    delete[] oldBytes;
+                }
+
+                std::memcpy(
+                        storage_type::bytes.dynamicStorage + storage_type::control.dynamicControlBlock.phySz,
+                        out, sz);
+                storage_type::control.dynamicControlBlock.phySz += sz;
+            }
+        };
+
+        // Grows by appending fixed-size chunks, so existing bytes are never moved or
+        // copied. Reads and writes that cross a chunk boundary are split transparently.
+        struct SegmentedStoragePolicy : IStorage<SegmentedStoragePolicy> {
+            using storage_type = IStorage<SegmentedStoragePolicy>;
+
+            static constexpr std::size_t segmentSize = 64 * 1024;
+
+            bool readImpl(char *elem, std::size_t sz) {
+                if (sz > storage_type::control.segmentedControlBlock.phySz -
+                         storage_type::control.segmentedControlBlock.readIdx) {
+                    return false;
+                }
+
+                storage_type::peekBytes(storage_type::control.segmentedControlBlock.readIdx, elem, sz);
+                storage_type::control.segmentedControlBlock.readIdx += sz;
+                return true;
+            }
+
+            bool skipImpl(std::size_t sz) {
+                if (sz > storage_type::control.segmentedControlBlock.phySz -
+                         storage_type::control.segmentedControlBlock.readIdx) {
+                    return false;
+                }
+
+                storage_type::control.segmentedControlBlock.readIdx += sz;
+                return true;
+            }
+
+            void writeImpl(const char *out, std::size_t sz) {
+                auto &chunks = storage_type::bytes.segmentedStorage->chunks;
+                while (storage_type::control.segmentedControlBlock.phySz + sz > chunks.size() * segmentSize) {
+                    chunks.emplace_back(new char[segmentSize]);
+                }
+
+                storage_type::patchBytes(storage_type::control.segmentedControlBlock.phySz, out, sz);
+                storage_type::control.segmentedControlBlock.phySz += sz;
+            }
+        };
+    }
+
+    namespace detail {
+        inline std::size_t nextCodecSlot() {
+            static std::atomic<std::size_t> next{0};
+            return next.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Dense per-type index, assigned on first use. Indexes CodecRegistry tables
+        // and per-type stats without hashing a std::type_index.
+        template<typename T>
+        std::size_t codecSlot() {
+            static const std::size_t slot = nextCodecSlot();
+            return slot;
+        }
+    }
+
+    namespace polices {
+        // Stats policies observe every primitive read/write of a Serializer. A policy
+        // with `enabled == false` is never called, so it costs nothing at runtime.
+        struct NullStatsPolicy {
+            static constexpr bool enabled = false;
+
+            template<typename T>
+            void onWrite(std::size_t) {}
+
+            template<typename T>
+            void onRead(std::size_t) {}
+
+            void onGrow(std::size_t, std::size_t, std::size_t) {}
+
+            void onSpanBegin(const char *) {}
+
+            void onSpanEnd(const char *) {}
+        };
+
+        // Counts bytes and calls in total, per primitive type, and per span. Wrap the
+        // encoding of each message type in Serializer::span("Name") to attribute its
+        // bytes to it; nested spans count towards the innermost one only.
+        struct CountingStatsPolicy {
+            static constexpr bool enabled = true;
+
+            struct Counters {
+                std::size_t bytesWritten{0};
+                std::size_t bytesRead{0};
+                std::size_t writeCalls{0};
+                std::size_t readCalls{0};
+            };
+
+            template<typename T>
+            void onWrite(std::size_t sz) {
+                Counters &type = typeCounters<T>();
+                type.bytesWritten += sz;
+                type.writeCalls++;
+                if (Counters *span = activeSpan()) {
+                    span->bytesWritten += sz;
+                    span->writeCalls++;
+                }
+                bytesWritten += sz;
+                writeCalls++;
+            }
+
+            template<typename T>
+            void onRead(std::size_t sz) {
+                Counters &type = typeCounters<T>();
+                type.bytesRead += sz;
+                type.readCalls++;
+                if (Counters *span = activeSpan()) {
+                    span->bytesRead += sz;
+                    span->readCalls++;
+                }
+                bytesRead += sz;
+                readCalls++;
+            }
+
+            void onGrow(std::size_t /*oldCapacity*/, std::size_t /*newCapacity*/, std::size_t copied) {
+                growthEvents++;
+                bytesCopied += copied;
+            }
+
+            // The span's counters are looked up once here, not on every primitive.
+            void onSpanBegin(const char *name) {
+                spans++;
+                m_activeSpans.push_back(&perSpan[name]);
+            }
+
+            void onSpanEnd(const char *) {
+                m_activeSpans.pop_back();
+            }
+
+            template<typename T>
+            [[nodiscard]] Counters forType() const {
+                std::size_t slot = detail::codecSlot<T>();
+                return slot < m_perType.size() ? m_perType[slot] : Counters{};
+            }
+
+            std::unordered_map<std::string, Counters> perSpan;
+            std::size_t bytesWritten{0};
+            std::size_t bytesRead{0};
+            std::size_t writeCalls{0};
+            std::size_t readCalls{0};
+            std::size_t growthEvents{0};
+            std::size_t bytesCopied{0};
+            std::size_t spans{0};
+
+        private:
+            template<typename T>
+            Counters &typeCounters() {
+                std::size_t slot = detail::codecSlot<T>();
+                if (slot >= m_perType.size()) {
+                    m_perType.resize(slot + 1);
+                }
+                return m_perType[slot];
+            }
+
+            Counters *activeSpan() {
+                return m_activeSpans.empty() ? nullptr : m_activeSpans.back();
+            }
+
+            std::vector<Counters> m_perType;
+            std::vector<Counters *> m_activeSpans;
+        };
+    }
+
+    enum class DecodeStatus {
+        Ok,
+        // The buffer ended before the value was complete.
+        Truncated,
+        // A length prefix claims more elements than the remaining bytes can hold.
+        LengthOverflow,
+        // A value that no valid encoding produces, e.g. an out-of-range variant index.
+        Invalid
+    };
+
+    // Specialize to declare that an enum only takes values in [0, max]; it is then
+    // written in just enough bytes for max, and in just enough bits by writeFlags().
+    //
+    //     template<> struct binser::enum_range<Color> { static constexpr Color max = Color::BLUE; };
+    template<typename E>
+    struct enum_range {
+    };
+
+    namespace detail {
+        template<typename T>
+        struct is_contiguous_container : std::false_type {
+        };
+
+        template<typename T, typename Alloc>
+        struct is_contiguous_container<std::vector<T, Alloc>> : std::true_type {
+        };
+
+        template<typename Alloc>
+        struct is_contiguous_container<std::vector<bool, Alloc>> : std::false_type {
+        };
+
+        enum class ContainerKind {
+            None, Sequence, Ordered, Unordered
+        };
+
+        // Describes how a standard container is rebuilt on read: appended to for
+        // sequences, hinted at end() for ordered containers, reserved for hashed ones.
+        template<typename T>
+        struct container_traits {
+            static constexpr ContainerKind kind = ContainerKind::None;
+        };
+
+        template<ContainerKind Kind, bool Mapped, bool Unique>
+        struct container_traits_base {
+            static constexpr ContainerKind kind = Kind;
+            static constexpr bool mapped = Mapped;
+            static constexpr bool unique = Unique;
+        };
+
+        template<typename T, typename Alloc>
+        struct container_traits<std::vector<T, Alloc>>
+                : container_traits_base<ContainerKind::Sequence, false, false> {
+        };
+
+        template<typename T, typename Alloc>
+        struct container_traits<std::deque<T, Alloc>>
+                : container_traits_base<ContainerKind::Sequence, false, false> {
+        };
+
+        template<typename T, typename Alloc>
+        struct container_traits<std::list<T, Alloc>>
+                : container_traits_base<ContainerKind::Sequence, false, false> {
+        };
+
+        template<typename K, typename Comp, typename Alloc>
+        struct container_traits<std::set<K, Comp, Alloc>>
+                : container_traits_base<ContainerKind::Ordered, false, true> {
+        };
+
+        template<typename K, typename Comp, typename Alloc>
+        struct container_traits<std::multiset<K, Comp, Alloc>>
+                : container_traits_base<ContainerKind::Ordered, false, false> {
+        };
+
+        template<typename K, typename V, typename Comp, typename Alloc>
+        struct container_traits<std::map<K, V, Comp, Alloc>>
+                : container_traits_base<ContainerKind::Ordered, true, true> {
+        };
+
+        template<typename K, typename V, typename Comp, typename Alloc>
+        struct container_traits<std::multimap<K, V, Comp, Alloc>>
+                : container_traits_base<ContainerKind::Ordered, true, false> {
+        };
+
+        template<typename K, typename Hash, typename Eq, typename Alloc>
+        struct container_traits<std::unordered_set<K, Hash, Eq, Alloc>>
+                : container_traits_base<ContainerKind::Unordered, false, true> {
+        };
+
+        template<typename K, typename Hash, typename Eq, typename Alloc>
+        struct container_traits<std::unordered_multiset<K, Hash, Eq, Alloc>>
+                : container_traits_base<ContainerKind::Unordered, false, false> {
+        };
+
+        template<typename K, typename V, typename Hash, typename Eq, typename Alloc>
+        struct container_traits<std::unordered_map<K, V, Hash, Eq, Alloc>>
+                : container_traits_base<ContainerKind::Unordered, true, true> {
+        };
+
+        template<typename K, typename V, typename Hash, typename Eq, typename Alloc>
+        struct container_traits<std::unordered_multimap<K, V, Hash, Eq, Alloc>>
+                : container_traits_base<ContainerKind::Unordered, true, false> {
+        };
+
+        template<typename Container, typename E>
+        void appendElement(Container &container, E &&elem) {
+            if constexpr (container_traits<Container>::kind == ContainerKind::Sequence) {
+                container.push_back(std::forward<E>(elem));
+            } else {
+                container.emplace_hint(container.end(), std::forward<E>(elem));
+            }
+        }
+
+        template<typename Container, typename K, typename V>
+        void appendEntry(Container &container, K &&key, V &&val) {
+            if constexpr (container_traits<Container>::unique) {
+                container.insert_or_assign(container.end(), std::forward<K>(key), std::forward<V>(val));
+            } else {
+                container.emplace_hint(container.end(), std::forward<K>(key), std::forward<V>(val));
+            }
+        }
+
+        // Inserts a node extracted from a container of the same type; a rejected
+        // duplicate key overwrites the existing value, as in appendEntry.
+        template<typename Container, typename Node>
+        void insertNode(Container &container, Node &node) {
+            auto it = container.insert(container.end(), std::move(node));
+            if constexpr (container_traits<Container>::mapped && container_traits<Container>::unique) {
+                if (node) {
+                    it->second = std::move(node.mapped());
+                }
+            }
+        }
+
+        // Holds the nodes of an associative container while it is decoded over
+        // itself. Kept per thread and per type so its capacity survives between
+        // decodes; callers swap it out, so a nested decode gets an empty one.
+        template<typename Container>
+        std::vector<typename Container::node_type> &nodeStash() {
+            thread_local std::vector<typename Container::node_type> stash;
+            return stash;
+        }
+
+        template<typename T>
+        struct is_std_array : std::false_type {
+        };
+
+        template<typename T, std::size_t N>
+        struct is_std_array<std::array<T, N>> : std::true_type {
+        };
+
+        template<typename T>
+        struct is_pair : std::false_type {
+        };
+
+        template<typename A, typename B>
+        struct is_pair<std::pair<A, B>> : std::true_type {
+        };
+
+        template<typename T>
+        struct is_tuple : std::false_type {
+        };
+
+        template<typename... Ts>
+        struct is_tuple<std::tuple<Ts...>> : std::true_type {
+        };
+
+        template<typename T>
+        struct is_optional : std::false_type {
+        };
+
+        template<typename T>
+        struct is_optional<std::optional<T>> : std::true_type {
+        };
+
+        template<typename T>
+        struct is_variant : std::false_type {
+        };
+
+        template<typename... Ts>
+        struct is_variant<std::variant<Ts...>> : std::true_type {
+        };
+
+        template<typename T>
+        struct is_bool_vector : std::false_type {
+        };
+
+        template<typename Alloc>
+        struct is_bool_vector<std::vector<bool, Alloc>> : std::true_type {
+        };
+
+        template<typename T>
+        struct is_bitset : std::false_type {
+        };
+
+        template<std::size_t N>
+        struct is_bitset<std::bitset<N>> : std::true_type {
+        };
+
+        template<typename E, typename = void>
+        struct has_enum_range : std::false_type {
+        };
+
+        template<typename E>
+        struct has_enum_range<E, std::void_t<decltype(enum_range<E>::max)>> : std::is_enum<E> {
+        };
+
+        template<typename E>
+        constexpr std::size_t enum_bits() {
+            auto max = static_cast<std::uint64_t>(enum_range<E>::max);
+            std::size_t bits = 0;
+            for (; max != 0; max >>= 1) {
+                bits++;
+            }
+            return bits == 0 ? 1 : bits;
+        }
+
+        // Types written as a fixed number of packed bytes rather than sizeof(T).
+        template<typename T>
+        inline constexpr bool is_packed_v = is_bitset<T>::value || has_enum_range<T>::value;
+
+        // Types whose encoding is their object bytes, so a run of them can be copied
+        // in one go. Packed types, optional and variant are trivially copyable but
+        // encoded field by field, so they are excluded.
+        template<typename T>
+        struct is_raw_encoded
+                : std::bool_constant<std::is_trivially_copyable_v<T> && !std::is_pointer_v<T> && !is_packed_v<T> &&
+                                     !is_optional<T>::value && !is_variant<T>::value && !is_tuple<T>::value> {
+        };
+
+        template<typename T, std::size_t N>
+        struct is_raw_encoded<std::array<T, N>> : is_raw_encoded<T> {
+        };
+
+        template<typename T>
+        inline constexpr bool is_bulk_copyable_v = is_raw_encoded<T>::value;
+
+        template<typename T>
+        constexpr std::size_t packed_size() {
+            if constexpr (is_bitset<T>::value) {
+                return (T{}.size() + 7) / 8;
+            } else {
+                return (enum_bits<T>() + 7) / 8;
+            }
+        }
+
+        // Packs bits [0, count) LSB-first into (count + 7) / 8 bytes, a 64-bit word at a time.
+        template<typename GetBit>
+        void packBits(std::size_t count, GetBit &&bit, std::uint8_t *out) {
+            for (std::size_t base = 0; base < count; base += 64) {
+                std::size_t n = std::min<std::size_t>(64, count - base);
+                std::uint64_t word = 0;
+                for (std::size_t i = 0; i < n; i++) {
+                    word |= static_cast<std::uint64_t>(static_cast<bool>(bit(base + i))) << i;
+                }
+                for (std::size_t b = 0; b < (n + 7) / 8; b++) {
+                    out[base / 8 + b] = static_cast<std::uint8_t>(word >> (8 * b));
+                }
+            }
+        }
+
+        template<typename SetBit>
+        void unpackBits(std::size_t count, const std::uint8_t *in, SetBit &&set) {
+            for (std::size_t base = 0; base < count; base += 64) {
+                std::size_t n = std::min<std::size_t>(64, count - base);
+                std::uint64_t word = 0;
+                for (std::size_t b = 0; b < (n + 7) / 8; b++) {
+                    word |= static_cast<std::uint64_t>(in[base / 8 + b]) << (8 * b);
+                }
+                for (std::size_t i = 0; i < n; i++) {
+                    set(base + i, static_cast<bool>((word >> i) & 1));
+                }
+            }
+        }
+
+        // Whether a raw value fits the declared range of T; bools always do.
+        template<typename T>
+        constexpr bool in_enum_range(std::uint64_t raw) {
+            if constexpr (has_enum_range<T>::value) {
+                return raw <= static_cast<std::uint64_t>(enum_range<T>::max);
+            } else {
+                return true;
+            }
+        }
+
+        template<typename T>
+        void encodePacked(const T &value, std::uint8_t *out) {
+            if constexpr (is_bitset<T>::value) {
+                packBits(value.size(), [&value](std::size_t i) { return value[i]; }, out);
+            } else {
+                auto raw = static_cast<std::uint64_t>(value);
+                for (std::size_t b = 0; b < packed_size<T>(); b++) {
+                    out[b] = static_cast<std::uint8_t>(raw >> (8 * b));
+                }
+            }
+        }
+
+        // Returns false, leaving `out` unchanged, for an enum value above its range.
+        template<typename T>
+        bool decodePacked(const std::uint8_t *in, T &out) {
+            if constexpr (is_bitset<T>::value) {
+                unpackBits(out.size(), in, [&out](std::size_t i, bool bit) { out[i] = bit; });
+            } else {
+                std::uint64_t raw = 0;
+                for (std::size_t b = 0; b < packed_size<T>(); b++) {
+                    raw |= static_cast<std::uint64_t>(in[b]) << (8 * b);
+                }
+                if (!in_enum_range<T>(raw)) {
+                    return false;
+                }
+                out = static_cast<T>(raw);
+            }
+            return true;
+        }
+
+        template<typename T>
+        constexpr std::size_t flag_bits() {
+            static_assert(std::is_same_v<T, bool> || has_enum_range<T>::value,
+                          "Only bools and enums with an enum_range can be packed as flags !");
+            if constexpr (std::is_same_v<T, bool>) {
+                return 1;
+            } else {
+                static_assert(enum_bits<T>() <= 32, "Enum range is too wide to pack as flags !");
+                return enum_bits<T>();
+            }
+        }
+
+        inline std::uint64_t loadLe64(const std::uint8_t *in) {
+            std::uint64_t word = 0;
+            for (std::size_t b = 0; b < 8; b++) {
+                word |= static_cast<std::uint64_t>(in[b]) << (8 * b);
+            }
+            return word;
+        }
+
+        inline void storeLe64(std::uint64_t word, std::uint8_t *out) {
+            for (std::size_t b = 0; b < 8; b++) {
+                out[b] = static_cast<std::uint8_t>(word >> (8 * b));
+            }
+        }
+
+        // Records opt into columnar encoding by declaring their fields as a tuple of
+        // member pointers: `static constexpr auto fields() { return std::make_tuple(&R::a, &R::b); }`
+        template<typename Record>
+        using record_fields_t = decltype(Record::fields());
+
+        template<typename Record>
+        inline constexpr std::size_t record_field_count_v = std::tuple_size_v<record_fields_t<Record>>;
+
+        template<typename MemberPtr>
+        struct member_type;
+
+        template<typename Record, typename Field>
+        struct member_type<Field Record::*> {
+            using type = Field;
+        };
+
+        template<typename Record, std::size_t I>
+        using record_field_t = typename member_type<std::tuple_element_t<I, record_fields_t<Record>>>::type;
+
+        template<typename T>
+        constexpr std::size_t min_encoded_size();
+
+        template<typename Tuple, std::size_t... Is>
+        constexpr std::size_t tuple_min_encoded_size(std::index_sequence<Is...>) {
+            return (std::size_t{0} + ... + min_encoded_size<std::tuple_element_t<Is, Tuple>>());
+        }
+
+        // Smallest number of bytes any encoding of T can occupy. Used to reject a
+        // length prefix before allocating for it.
+        template<typename T>
+        constexpr std::size_t min_encoded_size() {
+            if constexpr (container_traits<T>::kind != ContainerKind::None ||
+                          std::is_same_v<T, std::string>) {
+                return sizeof(std::size_t);
+            } else if constexpr (is_packed_v<T>) {
+                return packed_size<T>();
+            } else if constexpr (is_std_array<T>::value) {
+                return std::tuple_size_v<T> * min_encoded_size<typename T::value_type>();
+            } else if constexpr (is_pair<T>::value) {
+                return min_encoded_size<std::remove_const_t<typename T::first_type>>() +
+                       min_encoded_size<typename T::second_type>();
+            } else if constexpr (is_tuple<T>::value) {
+                return tuple_min_encoded_size<T>(std::make_index_sequence<std::tuple_size_v<T>>{});
+            } else if constexpr (is_optional<T>::value) {
+                return sizeof(bool);
+            } else if constexpr (is_variant<T>::value) {
+                return sizeof(std::size_t);
+            } else {
+                return sizeof(T);
+            }
+        }
+
+        template<typename Record, std::size_t... Is>
+        constexpr std::size_t record_min_encoded_size(std::index_sequence<Is...>) {
+            return (std::size_t{0} + ... + min_encoded_size<record_field_t<Record, Is>>());
+        }
+
+        // Smallest number of bytes one record occupies across its columns.
+        template<typename Record>
+        inline constexpr std::size_t record_min_encoded_size_v =
+                record_min_encoded_size<Record>(std::make_index_sequence<record_field_count_v<Record>>{});
+
+        // Container adapters keep their storage in the protected member `c`, and
+        // std::priority_queue its comparator in `comp`.
+        template<typename Adapter>
+        struct AdapterAccess : Adapter {
+            static const typename Adapter::container_type &get(const Adapter &adapter) {
+                return adapter.*&AdapterAccess::c;
+            }
+
+            static typename Adapter::container_type &get(Adapter &adapter) {
+                return adapter.*&AdapterAccess::c;
+            }
+
+            static const auto &compare(const Adapter &adapter) {
+                return adapter.*&AdapterAccess::comp;
+            }
+        };
+
+        template<typename Adapter>
+        auto &underlying(Adapter &adapter) {
+            return AdapterAccess<std::remove_const_t<Adapter>>::get(adapter);
+        }
+
+        template<typename Adapter>
+        const auto &comparator(const Adapter &adapter) {
+            return AdapterAccess<Adapter>::compare(adapter);
+        }
+    }
+
+    namespace checksum {
+        namespace detail {
+            constexpr std::uint32_t kCrc32cPoly = 0x82F63B78u;
+
+            constexpr std::array<std::uint32_t, 256> makeCrc32cTable() {
+                std::array<std::uint32_t, 256> table{};
+                for (std::uint32_t i = 0; i < 256; i++) {
+                    std::uint32_t crc = i;
+                    for (int bit = 0; bit < 8; bit++) {
+                        crc = (crc & 1) ? (crc >> 1) ^ kCrc32cPoly : crc >> 1;
+                    }
+                    table[i] = crc;
+                }
+                return table;
+            }
+
+            inline constexpr std::array<std::uint32_t, 256> kCrc32cTable = makeCrc32cTable();
+
+            inline std::uint32_t crc32cTable(std::uint32_t crc, const unsigned char *bytes, std::size_t sz) {
+                for (std::size_t i = 0; i < sz; i++) {
+                    crc = kCrc32cTable[(crc ^ bytes[i]) & 0xFF] ^ (crc >> 8);
+                }
+                return crc;
+            }
+
+#if defined(__SSE4_2__)
+            inline std::uint32_t crc32cHw(std::uint32_t crc, const unsigned char *bytes, std::size_t sz) {
+#if defined(__x86_64__) || defined(_M_X64)
+                std::uint64_t crc64 = crc;
+                for (; sz >= sizeof(std::uint64_t); sz -= sizeof(std::uint64_t), bytes += sizeof(std::uint64_t)) {
+                    std::uint64_t word;
+                    std::memcpy(&word, bytes, sizeof(word));
+                    crc64 = _mm_crc32_u64(crc64, word);
+                }
+                crc = static_cast<std::uint32_t>(crc64);
+#endif
+                for (; sz >= sizeof(std::uint32_t); sz -= sizeof(std::uint32_t), bytes += sizeof(std::uint32_t)) {
+                    std::uint32_t word;
+                    std::memcpy(&word, bytes, sizeof(word));
+                    crc = _mm_crc32_u32(crc, word);
+                }
+                for (; sz > 0; sz--, bytes++) {
+                    crc = _mm_crc32_u8(crc, *bytes);
+                }
+                return crc;
+            }
+#endif
+        }
+
+        // CRC32C (Castagnoli). Uses the SSE4.2 crc32 instruction when the target
+        // enables it (-msse4.2 / BINSER_ENABLE_SSE42), a lookup table otherwise.
+        inline std::uint32_t crc32c(const void *bytes, std::size_t sz, std::uint32_t seed = 0) {
+            const auto *ptr = static_cast<const unsigned char *>(bytes);
+#if defined(__SSE4_2__)
+            return ~detail::crc32cHw(~seed, ptr, sz);
+#else
+            return ~detail::crc32cTable(~seed, ptr, sz);
+#endif
+        }
+    }
+
+    // Process-wide codecs for one serializer type. Codecs receive the serializer
+    // as a parameter, so they are registered once at startup rather than on every
+    // instance. After freeze() the table is immutable and lookups take no lock.
+    //
+    //     auto &registry = binser::CodecRegistry<binser::DynamicBinSer>::instance();
+    //     registry.define<Person>(
+    //             [](binser::DynamicBinSer &ser, const Person &p) { ser.write(p.name); },
+    //             [](binser::DynamicBinSer &ser, Person &p) { ser.read(p.name); });
+    //     registry.freeze();
+    template<typename Ser>
+    class CodecRegistry {
+    public:
+        template<typename T>
+        using write_fn = void (*)(Ser &, const T &);
+
+        template<typename T>
+        using read_fn = void (*)(Ser &, T &);
+
+        static CodecRegistry &instance() {
+            static CodecRegistry registry;
+            return registry;
+        }
+
+        // Returns false, leaving the registry unchanged, once it has been frozen.
+        template<typename T>
+        bool define(write_fn<T> write, read_fn<T> read) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_frozen.load(std::memory_order_relaxed)) {
+                return false;
+            }
+
+            std::size_t slot = detail::codecSlot<T>();
+            if (slot >= m_codecs.size()) {
+                m_codecs.resize(slot + 1);
+            }
+            m_codecs[slot] = Codec{reinterpret_cast<erased_fn>(write), reinterpret_cast<erased_fn>(read)};
+            return true;
+        }
+
+        void freeze() {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_frozen.store(true, std::memory_order_release);
+        }
+
+        [[nodiscard]] bool frozen() const {
+            return m_frozen.load(std::memory_order_acquire);
+        }
+
+        // Returns false if no codec is registered for T.
+        template<typename T>
+        bool write(Ser &ser, const T &elem) const {
+            Codec codec = find<T>();
+            if (codec.write == nullptr) {
+                return false;
+            }
+            reinterpret_cast<write_fn<T>>(codec.write)(ser, elem);
+            return true;
+        }
+
+        template<typename T>
+        bool read(Ser &ser, T &elem) const {
+            Codec codec = find<T>();
+            if (codec.read == nullptr) {
+                return false;
+            }
+            reinterpret_cast<read_fn<T>>(codec.read)(ser, elem);
+            return true;
+        }
+
+    private:
+        using erased_fn = void (*)();
+
+        struct Codec {
+            erased_fn write{nullptr};
+            erased_fn read{nullptr};
+        };
+
+        // Returns a copy: before freeze() a concurrent define() may reallocate m_codecs.
+        template<typename T>
+        Codec find() const {
+            std::size_t slot = detail::codecSlot<T>();
+            if (frozen()) {
+                return slot < m_codecs.size() ? m_codecs[slot] : Codec{};
+            }
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return slot < m_codecs.size() ? m_codecs[slot] : Codec{};
+        }
+
+        std::vector<Codec> m_codecs;
+        std::atomic<bool> m_frozen{false};
+        mutable std::mutex m_mutex;
+    };
+
+    template<typename StoragePolicy, typename StatsPolicy = polices::NullStatsPolicy>
+    class Serializer : public polices::IStorage<StoragePolicy>, private StatsPolicy {
+        using map_type = std::unordered_map<std::type_index, std::function<void(void *)>>;
+
+    public:
+        class ScopedSpan {
+        public:
+            ScopedSpan(Serializer &ser, const char *name) : m_ser(ser), m_name(name) {
+                if constexpr (StatsPolicy::enabled) {
+                    m_ser.stats().onSpanBegin(m_name);
+                }
+            }
+
+            ScopedSpan(const ScopedSpan &) = delete;
 
-            void readImpl(char *elem, std::size_t sz) {
-                assert(storage_type::control.staticControlBlock.readIdx + sz <=
-                       storage_type::bytes.staticStorage.size() && "Buffer overflow !");
+            ScopedSpan &operator=(const ScopedSpan &) = delete;
 
-                if (storage_type::control.staticControlBlock.readIdx + sz >= storage_type::bytes.staticStorage.size()) {
-                    return;
+            ~ScopedSpan() {
+                if constexpr (StatsPolicy::enabled) {
+                    m_ser.stats().onSpanEnd(m_name);
                 }
+            }
 
-                std::memcpy(elem,
-                            storage_type::bytes.staticStorage.data() + storage_type::control.staticControlBlock.readIdx,
-                            sz);
-                storage_type::control.staticControlBlock.readIdx += sz;
+        private:
+            Serializer &m_ser;
+            const char *m_name;
+        };
+
+        // Random access into a vector written with writeIndexed(). Elements are
+        // decoded on access only; the view borrows the serializer's read position
+        // while decoding, so it must not be used concurrently with other reads.
+        template<typename E>
+        class IndexedView {
+        public:
+            IndexedView() = default;
+
+            IndexedView(Serializer &ser, std::size_t count, std::size_t table, std::size_t payload)
+                    : m_ser(&ser), m_count(count), m_table(table), m_payload(payload) {
             }
 
-            void writeImpl(const char *out, std::size_t sz) {
-                std::memcpy(
-                        storage_type::bytes.staticStorage.data() + storage_type::control.staticControlBlock.writeIdx,
-                        out, sz);
-                storage_type::control.staticControlBlock.writeIdx += sz;
+            [[nodiscard]] std::size_t size() const {
+                return m_count;
             }
-        };
 
-        struct DynamicStoragePolicy : IStorage<DynamicStoragePolicy> {
-            using storage_type = IStorage<DynamicStoragePolicy>;
+            [[nodiscard]] bool empty() const {
+                return m_count == 0;
+            }
 
-            void readImpl(char *elem, std::size_t sz) {
-                std::memcpy(elem,
-                            storage_type::bytes.dynamicStorage + storage_type::control.dynamicControlBlock.readIdx,
-                            sz);
-                storage_type::control.dynamicControlBlock.readIdx =
-                        (storage_type::control.dynamicControlBlock.readIdx + sz) %
-                        storage_type::control.dynamicControlBlock.logSz;
+            E operator[](std::size_t i) const {
+                E out{};
+                get(i, out);
+                return out;
             }
 
-            void writeImpl(const char *out, std::size_t sz) {
-                if (storage_type::control.dynamicControlBlock.phySz + sz >=
-                    storage_type::control.dynamicControlBlock.logSz
-                        ) {
-                    storage_type::control.dynamicControlBlock.logSz *= 2;
-                    auto *oldBytes = storage_type::bytes.dynamicStorage;
-                    storage_type::bytes.dynamicStorage = new char[storage_type::control.dynamicControlBlock.logSz];
-                    std::memcpy(storage_type::bytes.dynamicStorage, oldBytes,
-                                storage_type::control.dynamicControlBlock.phySz);
-                    delete[] oldBytes;
+            // Overwrites `out` with element i. Returns false if the element's offsets or
+            // encoding are malformed; the serializer's own status is left untouched.
+            bool get(std::size_t i, E &out) const {
+                assert(i < m_count && "Index out of range !");
+                std::size_t bounds[2];
+                m_ser->peekBytes(m_table + i * sizeof(std::size_t), reinterpret_cast<char *>(bounds), sizeof(bounds));
+                if (bounds[0] > bounds[1] || bounds[1] > m_ser->size() - m_payload) {
+                    return false;
                 }
 
-                std::memcpy(
-                        storage_type::bytes.dynamicStorage + storage_type::control.dynamicControlBlock.phySz,
-                        out, sz);
-                storage_type::control.dynamicControlBlock.phySz += sz;
+                std::size_t savedOffset = m_ser->readOffset();
+                DecodeStatus savedStatus = m_ser->m_status;
+                m_ser->seekRead(m_payload + bounds[0]);
+                m_ser->readAssign(out);
+                bool ok = m_ser->ok() && m_ser->readOffset() == m_payload + bounds[1];
+                m_ser->seekRead(savedOffset);
+                m_ser->m_status = savedStatus;
+                return ok;
             }
+
+        private:
+            Serializer *m_ser{nullptr};
+            std::size_t m_count{0};
+            std::size_t m_table{0};
+            std::size_t m_payload{0};
         };
-    }
 
-    template<typename StoragePolicy>
-    class Serializer : public polices::IStorage<StoragePolicy> {
-        using map_type = std::unordered_map<std::type_index, std::function<void(void *)>>;
+        StatsPolicy &stats() {
+            return *this;
+        }
+
+        [[nodiscard]] ScopedSpan span(const char *name) {
+            return ScopedSpan{*this, name};
+        }
 
-    public:
         template<typename T>
         void write(const T &elem) {
-            polices::IStorage<StoragePolicy>::write(elem);
+            if constexpr (detail::is_bool_vector<T>::value) {
+                writeBoolVector(elem);
+            } else if constexpr (detail::is_packed_v<T>) {
+                std::array<std::uint8_t, detail::packed_size<T>()> bytes{};
+                detail::encodePacked(elem, bytes.data());
+                writeRaw(bytes.data(), bytes.size());
+            } else if constexpr (detail::container_traits<T>::kind != detail::ContainerKind::None) {
+                writeElements(elem);
+            } else if constexpr (detail::is_std_array<T>::value) {
+                writeFixed(elem);
+            } else if constexpr (detail::is_pair<T>::value) {
+                write(elem.first);
+                write(elem.second);
+            } else if constexpr (detail::is_tuple<T>::value) {
+                std::apply([this](const auto &...fields) { (write(fields), ...); }, elem);
+            } else if constexpr (detail::is_optional<T>::value) {
+                write(elem.has_value());
+                if (elem) {
+                    write(*elem);
+                }
+            } else if constexpr (detail::is_variant<T>::value) {
+                write(elem.index());
+                std::visit([this](const auto &alt) { write(alt); }, elem);
+            } else {
+                writeRaw(std::addressof(elem), 1);
+            }
         }
 
         template<typename T>
         void read(T &&out) {
-            polices::IStorage<StoragePolicy>::read(out);
+            using U = std::remove_reference_t<T>;
+
+            if constexpr (detail::is_bool_vector<U>::value) {
+                readBoolVector(out);
+            } else if constexpr (detail::is_packed_v<U>) {
+                std::array<std::uint8_t, detail::packed_size<U>()> bytes{};
+                readRaw(bytes.data(), bytes.size());
+                if (ok() && !detail::decodePacked(bytes.data(), out)) {
+                    m_status = DecodeStatus::Invalid;
+                }
+            } else if constexpr (detail::container_traits<U>::kind != detail::ContainerKind::None) {
+                readElements(out);
+            } else if constexpr (detail::is_std_array<U>::value) {
+                readFixed(out);
+            } else if constexpr (detail::is_pair<U>::value) {
+                read(out.first);
+                read(out.second);
+            } else if constexpr (detail::is_tuple<U>::value) {
+                std::apply([this](auto &...fields) { (read(fields), ...); }, out);
+            } else if constexpr (detail::is_optional<U>::value) {
+                bool hasValue = false;
+                read(hasValue);
+                if (!ok()) {
+                    return;
+                }
+                if (hasValue) {
+                    if (!out) {
+                        out.emplace();
+                    }
+                    read(*out);
+                } else {
+                    out.reset();
+                }
+            } else if constexpr (detail::is_variant<U>::value) {
+                std::size_t index = 0;
+                read(index);
+                if (checkVariantIndex<U>(index)) {
+                    readVariant(out, index, std::make_index_sequence<std::variant_size_v<U>>{});
+                }
+            } else {
+                readRaw(std::addressof(out), 1);
+            }
         }
 
         void write(const char *cstr) {
@@ -162,6 +1239,9 @@ namespace binser {
             assert(outCstr != nullptr && "c_str is null !");
             size_t len;
             read(len);
+            if (!checkLength(len, sizeof(char))) {
+                return;
+            }
 
             for (size_t i = 0; i < len; i++) {
                 read(outCstr[i]);
@@ -170,20 +1250,19 @@ namespace binser {
 
         void write(const std::string &str) {
             write(str.length());
-            for (auto &&c: str) {
-                write(c);
-            }
+            writeRaw(str.data(), str.length());
         }
 
         void read(std::string &out) {
             size_t size;
             read(size);
-
-            for (int i = 0; i < size; i++) {
-                char c;
-                read(c);
-                out.push_back(c);
+            if (!checkLength(size, sizeof(char))) {
+                return;
             }
+
+            std::size_t oldSize = out.size();
+            out.resize(oldSize + size);
+            readRaw(out.data() + oldSize, size);
         }
 
         template<typename T>
@@ -200,267 +1279,747 @@ namespace binser {
             }
         }
 
-        template<typename E>
-        void write(const std::vector<E> &vec) {
-            write(vec.size());
-            for (auto &&elem: vec) {
-                write(elem);
+        template<typename T, std::size_t N>
+        void write(const T (&arr)[N]) {
+            for (int i = 0; i < N; i++) {
+                write(arr[i]);
             }
         }
 
-        template<typename E>
-        void read(std::vector<E> &out) {
-            size_t size;
-            read(size);
-
-            for (int i = 0; i < size; i++) {
-                E c;
-                read(c);
-                out.push_back(c);
+        template<typename T, std::size_t N>
+        void read(T (&arr)[N]) {
+            for (int i = 0; i < N; i++) {
+                read(arr[i]);
             }
         }
 
-        template<typename K, typename V>
-        void write(const std::unordered_map<K, V> &map) {
-            write(map.size());
+        template<typename T, typename Container>
+        void write(const std::stack<T, Container> &stack) {
+            writeElements(detail::underlying(stack));
+        }
+
+        template<typename T, typename Container>
+        void read(std::stack<T, Container> &stack) {
+            readElements(detail::underlying(stack));
+        }
+
+        template<typename T, typename Container>
+        void write(const std::queue<T, Container> &queue) {
+            writeElements(detail::underlying(queue));
+        }
+
+        template<typename T, typename Container>
+        void read(std::queue<T, Container> &queue) {
+            readElements(detail::underlying(queue));
+        }
+
+        // Written in heap order rather than pop order; the reader re-heapifies in O(n).
+        template<typename T, typename Container, typename Compare>
+        void write(const std::priority_queue<T, Container, Compare> &queue) {
+            writeElements(detail::underlying(queue));
+        }
+
+        template<typename T, typename Container, typename Compare>
+        void read(std::priority_queue<T, Container, Compare> &queue) {
+            auto &container = detail::underlying(queue);
+            readElements(container);
+            std::make_heap(container.begin(), container.end(), detail::comparator(queue));
+        }
 
-            for (const auto &[key, val]: map) {
-                write(key);
-                write(val);
+        // Decodes over `out` instead of appending to it. Strings and containers keep
+        // their allocations: existing elements and map/set nodes (and their own
+        // buffers, e.g. the strings of a std::vector<std::string>) are decoded in
+        // place, so re-reading same-shaped messages into one long-lived object
+        // does not allocate.
+        template<typename T>
+        void readAssign(T &out) {
+            if constexpr (std::is_same_v<T, std::string>) {
+                size_t size;
+                read(size);
+                if (!checkLength(size, sizeof(char))) {
+                    return;
+                }
+                out.resize(size);
+                readRaw(out.data(), size);
+            } else if constexpr (detail::is_bool_vector<T>::value) {
+                out.clear();
+                readBoolVector(out);
+            } else if constexpr (detail::container_traits<T>::kind != detail::ContainerKind::None) {
+                assignElements(out);
+            } else if constexpr (detail::is_std_array<T>::value) {
+                if constexpr (detail::is_bulk_copyable_v<typename T::value_type>) {
+                    readFixed(out);
+                } else {
+                    for (auto &elem: out) {
+                        readAssign(elem);
+                    }
+                }
+            } else if constexpr (detail::is_pair<T>::value) {
+                readAssign(out.first);
+                readAssign(out.second);
+            } else if constexpr (detail::is_tuple<T>::value) {
+                std::apply([this](auto &...fields) { (readAssign(fields), ...); }, out);
+            } else if constexpr (detail::is_optional<T>::value) {
+                bool hasValue = false;
+                read(hasValue);
+                if (!ok()) {
+                    return;
+                }
+                if (hasValue) {
+                    if (!out) {
+                        out.emplace();
+                    }
+                    readAssign(*out);
+                } else {
+                    out.reset();
+                }
+            } else if constexpr (detail::is_variant<T>::value) {
+                std::size_t index = 0;
+                read(index);
+                if (!checkVariantIndex<T>(index)) {
+                    return;
+                } else if (index == out.index()) {
+                    std::visit([this](auto &alt) { readAssign(alt); }, out);
+                } else {
+                    readVariant(out, index, std::make_index_sequence<std::variant_size_v<T>>{});
+                }
+            } else {
+                read(out);
             }
         }
 
-        template<typename K, typename V>
-        void read(std::unordered_map<K, V> &map) {
-            size_t size;
-            read(size);
+        template<typename T, typename Container>
+        void readAssign(std::stack<T, Container> &stack) {
+            assignElements(detail::underlying(stack));
+        }
 
-            for (int i = 0; i < size; i++) {
-                K key;
-                read(key);
+        template<typename T, typename Container>
+        void readAssign(std::queue<T, Container> &queue) {
+            assignElements(detail::underlying(queue));
+        }
 
-                V val;
-                read(val);
+        template<typename T, typename Container, typename Compare>
+        void readAssign(std::priority_queue<T, Container, Compare> &queue) {
+            auto &container = detail::underlying(queue);
+            assignElements(container);
+            std::make_heap(container.begin(), container.end(), detail::comparator(queue));
+        }
 
-                map[key] = val;
+        // Packs bools and enums with an enum_range into shared bytes, e.g.
+        // writeFlags(a.enabled, a.visible, a.color) takes one byte for 1 + 1 + 2 bits.
+        template<typename... Fields>
+        void writeFlags(const Fields &...fields) {
+            constexpr std::size_t totalBits = (std::size_t{0} + ... + detail::flag_bits<Fields>());
+            std::array<std::uint8_t, (totalBits + 7) / 8 + 8> bytes{};
+            std::size_t bitPos = 0;
+
+            auto put = [&bytes, &bitPos](std::uint64_t value, std::size_t bits) {
+                std::uint8_t *at = bytes.data() + bitPos / 8;
+                value &= (std::uint64_t{1} << bits) - 1;
+                detail::storeLe64(detail::loadLe64(at) | value << (bitPos % 8), at);
+                bitPos += bits;
+            };
+            assert((detail::in_enum_range<Fields>(static_cast<std::uint64_t>(fields)) && ...) &&
+                   "Flag value exceeds its enum_range !");
+            (put(static_cast<std::uint64_t>(fields), detail::flag_bits<Fields>()), ...);
+
+            writeRaw(bytes.data(), (totalBits + 7) / 8);
+        }
+
+        template<typename... Fields>
+        void readFlags(Fields &...fields) {
+            constexpr std::size_t totalBits = (std::size_t{0} + ... + detail::flag_bits<Fields>());
+            std::array<std::uint8_t, (totalBits + 7) / 8 + 8> bytes{};
+            readRaw(bytes.data(), (totalBits + 7) / 8);
+            if (!ok()) {
+                return;
             }
+
+            std::size_t bitPos = 0;
+            auto get = [&bytes, &bitPos](std::size_t bits) {
+                std::uint64_t word = detail::loadLe64(bytes.data() + bitPos / 8) >> (bitPos % 8);
+                bitPos += bits;
+                return word & ((std::uint64_t{1} << bits) - 1);
+            };
+            std::array<std::uint64_t, sizeof...(Fields)> raw{get(detail::flag_bits<Fields>())...};
+            std::size_t i = 0;
+            if (!(detail::in_enum_range<Fields>(raw[i++]) && ...)) {
+                m_status = DecodeStatus::Invalid;
+                return;
+            }
+            i = 0;
+            ((fields = static_cast<Fields>(raw[i++])), ...);
         }
 
-        template<typename T, std::size_t N>
-        void write(const T (&arr)[N]) {
-            for (int i = 0; i < N; i++) {
-                write(arr[i]);
+        // Indexed layout: [count][count + 1 element offsets][elements]. The offsets are
+        // relative to the first element, so readIndexed() can hand out a view that
+        // decodes any element in O(1) without touching the others.
+        template<typename E>
+        void writeIndexed(const std::vector<E> &vec) {
+            write(vec.size());
+
+            std::size_t table = this->size();
+            std::vector<std::size_t> offsets(vec.size() + 1);
+            writeRaw(offsets.data(), offsets.size());
+
+            std::size_t payload = this->size();
+            for (std::size_t i = 0; i < vec.size(); i++) {
+                offsets[i] = this->size() - payload;
+                write(vec[i]);
             }
+            offsets[vec.size()] = this->size() - payload;
+
+            this->patchBytes(table, reinterpret_cast<const char *>(offsets.data()),
+                             offsets.size() * sizeof(std::size_t));
         }
 
-        template<typename T, std::size_t N>
-        void read(T (&arr)[N]) {
-            for (int i = 0; i < N; i++) {
-                read(arr[i]);
+        // Consumes an indexed vector and returns a lazy view over it.
+        template<typename E>
+        IndexedView<E> readIndexed() {
+            size_t count;
+            read(count);
+            if (!checkLength(count, sizeof(std::size_t))) {
+                return {};
+            }
+
+            std::size_t table = this->readOffset();
+            std::size_t payload = table + (count + 1) * sizeof(std::size_t);
+            if (payload > this->size()) {
+                m_status = DecodeStatus::Truncated;
+                return {};
+            }
+
+            std::size_t payloadLen;
+            this->peekBytes(payload - sizeof(std::size_t), reinterpret_cast<char *>(&payloadLen), sizeof(payloadLen));
+            if (!this->skipBytes(payload - table) || !this->skipBytes(payloadLen)) {
+                m_status = DecodeStatus::Truncated;
+                return {};
             }
+            return IndexedView<E>{*this, count, table, payload};
+        }
+
+        // Decoding never reads past the written bytes. The first failure is latched
+        // here and turns every later read into a no-op until clearStatus().
+        [[nodiscard]] DecodeStatus status() const {
+            return m_status;
+        }
+
+        [[nodiscard]] bool ok() const {
+            return m_status == DecodeStatus::Ok;
+        }
+
+        void clearStatus() {
+            m_status = DecodeStatus::Ok;
+        }
+
+        template<typename T>
+        [[nodiscard]] DecodeStatus tryRead(T &out) {
+            read(out);
+            return m_status;
         }
 
-        template<typename K, typename V>
-        void write(const std::map<K, V> map) {
-            write(map.size());
+        // Columnar layout: [count] then, for each declared field, [byteLength][column].
+        // The byte length lets readColumn() skip the columns it does not need.
+        template<typename Record>
+        void writeColumns(const std::vector<Record> &records) {
+            write(records.size());
+            writeColumnsImpl(records, std::make_index_sequence<detail::record_field_count_v<Record>>{});
+        }
 
-            for (const auto &[key, val]: map) {
-                write(key);
-                write(val);
+        // Appends the records written by writeColumns.
+        template<typename Record>
+        void readColumns(std::vector<Record> &records) {
+            size_t size;
+            read(size);
+            if (!checkLength(size, detail::record_min_encoded_size_v<Record>)) {
+                return;
             }
+
+            std::size_t oldSize = records.size();
+            records.resize(oldSize + size);
+            readColumnsImpl(records, oldSize, std::make_index_sequence<detail::record_field_count_v<Record>>{});
         }
 
-        template<typename K, typename V>
-        void read(std::map<K, V> &map) {
+        // Decodes only field I of a columnar vector of Record, skipping every other column.
+        template<typename Record, std::size_t I>
+        void readColumn(std::vector<detail::record_field_t<Record, I>> &out) {
+            using Field = detail::record_field_t<Record, I>;
+
             size_t size;
             read(size);
+            if (!checkLength(size, detail::min_encoded_size<Field>())) {
+                return;
+            }
 
-            for (int i = 0; i < size; i++) {
-                K key;
-                read(key);
+            for (std::size_t col = 0; col < detail::record_field_count_v<Record>; col++) {
+                std::size_t columnLen = 0;
+                read(columnLen);
 
-                V val;
-                read(val);
+                if (col != I) {
+                    if (ok() && !this->skipBytes(columnLen)) {
+                        m_status = DecodeStatus::Truncated;
+                    }
+                    continue;
+                }
 
-                map[key] = val;
+                std::size_t columnBegin = this->readOffset();
+                if constexpr (detail::is_bulk_copyable_v<Field>) {
+                    std::size_t oldSize = out.size();
+                    out.resize(oldSize + size);
+                    readRaw(out.data() + oldSize, size);
+                } else {
+                    out.reserve(out.size() + size);
+                    for (std::size_t i = 0; i < size; i++) {
+                        Field field;
+                        read(field);
+                        out.push_back(std::move(field));
+                    }
+                }
+                checkColumnLength(columnBegin, columnLen);
             }
         }
 
-        template<typename K>
-        void write(const std::set<K> &set) {
-            write(set.size());
-            for (auto &&key: set) {
-                write(key);
+        // Checksummed blocks are laid out as [length][crc32c][payload], so a reader
+        // can validate the payload with verifyBlock() before decoding any of it.
+        static constexpr std::size_t blockHeaderSize = sizeof(std::size_t) + sizeof(std::uint32_t);
+
+        void beginBlock() {
+            assert(!m_blockOpen && "Checksum block already open !");
+            m_blockBegin = this->size();
+            m_blockOpen = true;
+
+            std::size_t len = 0;
+            std::uint32_t crc = 0;
+            write(len);
+            write(crc);
+        }
+
+        void endBlock() {
+            assert(m_blockOpen && "No checksum block open !");
+            std::size_t len = this->size() - m_blockBegin - blockHeaderSize;
+            std::uint32_t crc = rangeChecksum(m_blockBegin + blockHeaderSize, len);
+
+            this->patchBytes(m_blockBegin, reinterpret_cast<const char *>(&len), sizeof(len));
+            this->patchBytes(m_blockBegin + sizeof(len), reinterpret_cast<const char *>(&crc), sizeof(crc));
+            m_blockOpen = false;
+        }
+
+        // Returns false, without consuming anything, if the next block is truncated
+        // or its payload does not match the stored checksum.
+        bool verifyBlock() {
+            if (this->remaining() < blockHeaderSize) {
+                return false;
+            }
+
+            std::size_t block = this->readOffset();
+            std::size_t len;
+            std::uint32_t crc;
+            this->peekBytes(block, reinterpret_cast<char *>(&len), sizeof(len));
+            this->peekBytes(block + sizeof(len), reinterpret_cast<char *>(&crc), sizeof(crc));
+
+            if (len > this->remaining() - blockHeaderSize ||
+                rangeChecksum(block + blockHeaderSize, len) != crc) {
+                return false;
             }
+
+            read(len);
+            read(crc);
+            return true;
         }
 
-        template<typename K>
-        void read(std::set<K> &set) {
-            size_t size;
-            read(size);
+        [[nodiscard]] std::uint32_t checksum() {
+            return rangeChecksum(0, this->size());
+        }
+
+        // Per-instance templates override the process-wide CodecRegistry. Their maps
+        // are only allocated once the first template is defined.
+        void defineTemplateRead(const std::type_index &info, const std::function<void(void *)> &func) {
+            auto &templates = instanceTemplates().serialization;
+            if (templates.find(info) == templates.end()) {
+                templates[info] = func;
+            }
+        }
 
-            for (int i = 0; i < size; i++) {
-                K tmp;
-                read(tmp);
-                set.insert(tmp);
+        void defineTemplateWrite(const std::type_index &info, const std::function<void(void *)> &func) {
+            auto &templates = instanceTemplates().deserialization;
+            if (templates.find(info) == templates.end()) {
+                templates[info] = func;
             }
         }
 
         template<typename T>
-        void write(std::stack<T> &stack) {
-            std::vector<T> vec;
+        void readRegObject(T &elem) {
+            if (m_templates) {
+                auto obj = m_templates->serialization.find(typeid(T));
+                if (obj != m_templates->serialization.end()) {
+                    obj->second((void *) &elem);
+                    return;
+                }
+            }
+            CodecRegistry<Serializer>::instance().read(*this, elem);
+        }
 
-            while (!stack.empty()) {
-                T elem = stack.top();
-                vec.push_back(elem);
-                stack.pop();
+        template<typename T>
+        void writeRegObject(T &elem) {
+            if (m_templates) {
+                auto obj = m_templates->deserialization.find(typeid(T));
+                if (obj != m_templates->deserialization.end()) {
+                    obj->second((void *) &elem);
+                    return;
+                }
             }
+            CodecRegistry<Serializer>::instance().write(*this, elem);
+        }
 
-            typename std::vector<T>::reverse_iterator rit = vec.rbegin();
-            size_t size = vec.size();
+    private:
+        struct InstanceTemplates {
+            map_type serialization;
+            map_type deserialization;
+        };
 
-            write(size);
-            while (rit != vec.rend()) {
-                write(*rit);
-                rit++;
+        InstanceTemplates &instanceTemplates() {
+            if (!m_templates) {
+                m_templates = std::make_unique<InstanceTemplates>();
             }
+            return *m_templates;
+        }
 
-            for (auto &&elem: vec) {
-                stack.push(elem);
-            }
+        std::uint32_t rangeChecksum(std::size_t offset, std::size_t len) {
+            std::uint32_t crc = 0;
+            this->forEachSpan(offset, len, [&crc](const char *span, std::size_t n) {
+                crc = checksum::crc32c(span, n, crc);
+            });
+            return crc;
         }
 
         template<typename T>
-        void read(std::stack<T> &stack) {
-            size_t size;
-            read(size);
+        void writeRaw(const T *ptr, std::size_t n) {
+            if (n == 0) {
+                return;
+            }
+            const auto *bytes = reinterpret_cast<const char *>(ptr);
+            if constexpr (StatsPolicy::enabled) {
+                std::size_t oldCapacity = this->capacity();
+                std::size_t oldSize = this->size();
+
+                polices::IStorage<StoragePolicy>::writeBytes(bytes, n * sizeof(T));
+                stats().template onWrite<T>(n * sizeof(T));
 
-            for (int i = 0; i < size; i++) {
-                T tmp;
-                read(tmp);
-                stack.push(std::move(tmp));
+                if (this->capacity() != oldCapacity) {
+                    stats().onGrow(oldCapacity, this->capacity(),
+                                   polices::traits::is_segmented_v<StoragePolicy>::value ? 0 : oldSize);
+                }
+            } else {
+                polices::IStorage<StoragePolicy>::writeBytes(bytes, n * sizeof(T));
             }
         }
 
         template<typename T>
-        void write(std::queue<T> &queue) {
-            std::vector<T> vec;
-
-            while (!queue.empty()) {
-                vec.push_back(queue.front());
-                queue.pop();
+        void readRaw(T *ptr, std::size_t n) {
+            if (m_status != DecodeStatus::Ok || n == 0) {
+                return;
+            }
+            if (!polices::IStorage<StoragePolicy>::readBytes(reinterpret_cast<char *>(ptr), n * sizeof(T))) {
+                m_status = DecodeStatus::Truncated;
+                return;
+            }
+            if constexpr (StatsPolicy::enabled) {
+                stats().template onRead<T>(n * sizeof(T));
             }
+        }
 
-            write(vec.size());
-            for (auto &&elem: vec) {
-                write(elem);
+        // Rejects a length prefix that cannot fit in the remaining bytes, once per
+        // container, before anything is allocated for it.
+        bool checkLength(std::size_t count, std::size_t minElemSize) {
+            if (m_status != DecodeStatus::Ok) {
+                return false;
             }
+            if (minElemSize != 0 && count > this->remaining() / minElemSize) {
+                m_status = DecodeStatus::LengthOverflow;
+                return false;
+            }
+            return true;
+        }
 
-            for (auto &&elem: vec) {
-                queue.push(elem);
+        // Writes size + elements, as a single copy when the elements are contiguous
+        // and trivially copyable.
+        template<typename Container>
+        void writeElements(const Container &container) {
+            using E = typename Container::value_type;
+
+            write(container.size());
+            if constexpr (detail::is_contiguous_container<Container>::value && detail::is_bulk_copyable_v<E>) {
+                writeRaw(container.data(), container.size());
+            } else {
+                for (auto &&elem: container) {
+                    write(elem);
+                }
             }
         }
 
-        template<typename T>
-        void read(std::queue<T> &queue) {
+        // Appends the elements written by writeElements. Ordered containers were
+        // written in comparator order, so hinting at end() builds them in O(n).
+        template<typename Container>
+        void readElements(Container &container) {
+            using traits = detail::container_traits<Container>;
+            using E = typename Container::value_type;
+
             size_t size;
             read(size);
-
-            for (int i = 0; i < size; i++) {
-                T tmp;
-                read(tmp);
-                queue.push(std::move(tmp));
+            if (!checkLength(size, detail::min_encoded_size<E>())) {
+                return;
             }
-        }
 
-        template<typename T>
-        void write(std::priority_queue<T> &queue) {
-            std::vector<T> vec;
+            if constexpr (detail::is_contiguous_container<Container>::value && detail::is_bulk_copyable_v<E>) {
+                std::size_t oldSize = container.size();
+                container.resize(oldSize + size);
+                readRaw(container.data() + oldSize, size);
+                return;
+            }
 
-            while (!queue.empty()) {
-                vec.push_back(queue.top());
-                queue.pop();
+            if constexpr (detail::is_contiguous_container<Container>::value ||
+                          traits::kind == detail::ContainerKind::Unordered) {
+                container.reserve(container.size() + size);
             }
 
-            write(vec.size());
-            for (auto &&elem: vec) {
-                write(elem);
+            for (std::size_t i = 0; i < size; i++) {
+                if (!readEntry(container)) {
+                    return;
+                }
             }
+        }
 
-            for (auto &&elem: vec) {
-                queue.push(elem);
+        // Decodes one element into a fresh value and moves it into the container.
+        template<typename Container>
+        bool readEntry(Container &container) {
+            if constexpr (detail::container_traits<Container>::mapped) {
+                typename Container::key_type key;
+                typename Container::mapped_type val;
+                read(key);
+                read(val);
+                if (!ok()) {
+                    return false;
+                }
+                detail::appendEntry(container, std::move(key), std::move(val));
+            } else {
+                typename Container::value_type elem;
+                read(elem);
+                if (!ok()) {
+                    return false;
+                }
+                detail::appendElement(container, std::move(elem));
             }
+            return true;
         }
 
-        template<typename T>
-        void read(std::priority_queue<T> &queue) {
+        // Replaces the contents with the elements written by writeElements. Sequence
+        // elements are decoded in place; associative containers recycle their nodes
+        // through extract() and keep their buckets, so only elements beyond the old
+        // size are allocated.
+        template<typename Container>
+        void assignElements(Container &container) {
+            using traits = detail::container_traits<Container>;
+            using E = typename Container::value_type;
+
+            if constexpr (detail::is_contiguous_container<Container>::value && detail::is_bulk_copyable_v<E>) {
+                container.clear();
+                readElements(container);
+                return;
+            }
+
             size_t size;
             read(size);
+            if (!checkLength(size, detail::min_encoded_size<E>())) {
+                return;
+            }
+
+            if constexpr (traits::kind == detail::ContainerKind::Sequence) {
+                container.resize(size);
+                std::size_t i = 0;
+                for (auto it = container.begin(); it != container.end(); ++it, ++i) {
+                    readAssign(*it);
+                    if (!ok()) {
+                        container.resize(i);
+                        return;
+                    }
+                }
+            } else {
+                std::vector<typename Container::node_type> nodes;
+                nodes.swap(detail::nodeStash<Container>());
+                while (!container.empty()) {
+                    nodes.push_back(container.extract(container.begin()));
+                }
+
+                for (std::size_t i = 0; i < size; i++) {
+                    if (i >= nodes.size()) {
+                        if (!readEntry(container)) {
+                            break;
+                        }
+                        continue;
+                    }
+
+                    auto &node = nodes[i];
+                    if constexpr (traits::mapped) {
+                        readAssign(node.key());
+                        readAssign(node.mapped());
+                    } else {
+                        readAssign(node.value());
+                    }
+                    if (!ok()) {
+                        break;
+                    }
+                    detail::insertNode(container, node);
+                }
 
-            for (int i = 0; i < size; i++) {
-                T tmp;
-                read(tmp);
-                queue.push(std::move(tmp));
+                nodes.clear();
+                nodes.swap(detail::nodeStash<Container>());
             }
         }
 
-        template<typename T>
-        void write(const std::deque<T> &deque) {
-            std::vector<T> vec{deque.cbegin(), deque.cend()};
-
+        // std::vector<bool> is written as its size followed by the bits, packed
+        // LSB-first into bytes.
+        template<typename Vec>
+        void writeBoolVector(const Vec &vec) {
             write(vec.size());
-            for (auto &&elem: vec) {
-                write(elem);
+
+            std::array<std::uint8_t, 512> chunk{};
+            constexpr std::size_t chunkBits = chunk.size() * 8;
+            for (std::size_t base = 0; base < vec.size(); base += chunkBits) {
+                std::size_t n = std::min(chunkBits, vec.size() - base);
+                detail::packBits(n, [&vec, base](std::size_t i) { return vec[base + i]; }, chunk.data());
+                writeRaw(chunk.data(), (n + 7) / 8);
             }
         }
 
-        template<typename T>
-        void read(std::deque<T> &deque) {
+        template<typename Vec>
+        void readBoolVector(Vec &vec) {
             size_t size;
             read(size);
+            if (!checkLength(size / 8 + (size % 8 != 0), 1)) {
+                return;
+            }
+
+            std::size_t oldSize = vec.size();
+            vec.resize(oldSize + size);
 
-            for (int i = 0; i < size; i++) {
-                T tmp;
-                read(tmp);
-                deque.push_front(std::move(tmp));
+            std::array<std::uint8_t, 512> chunk{};
+            constexpr std::size_t chunkBits = chunk.size() * 8;
+            for (std::size_t base = 0; base < size; base += chunkBits) {
+                std::size_t n = std::min(chunkBits, size - base);
+                readRaw(chunk.data(), (n + 7) / 8);
+                if (!ok()) {
+                    return;
+                }
+                detail::unpackBits(n, chunk.data(), [&vec, oldSize, base](std::size_t i, bool bit) {
+                    vec[oldSize + base + i] = bit;
+                });
             }
         }
 
-        void defineTemplateRead(const std::type_index &info, const std::function<void(void *)> &func) {
-            if (m_serializationTemplate.find(info) == m_serializationTemplate.end()) {
-                m_serializationTemplate[info] = func;
+        template<typename Array>
+        void writeFixed(const Array &arr) {
+            if constexpr (detail::is_bulk_copyable_v<typename Array::value_type>) {
+                writeRaw(arr.data(), arr.size());
+            } else {
+                for (auto &&elem: arr) {
+                    write(elem);
+                }
             }
         }
 
-        void defineTemplateWrite(const std::type_index &info, const std::function<void(void *)> &func) {
-            if (m_deserializationTemplate.find(info) == m_deserializationTemplate.end()) {
-                m_deserializationTemplate[info] = func;
+        template<typename Array>
+        void readFixed(Array &arr) {
+            if constexpr (detail::is_bulk_copyable_v<typename Array::value_type>) {
+                readRaw(arr.data(), arr.size());
+            } else {
+                for (auto &elem: arr) {
+                    read(elem);
+                }
             }
         }
 
-        template<typename T>
-        void readRegObject(T &elem) {
-            auto obj = m_serializationTemplate.find(typeid(T));
-            if (obj != m_serializationTemplate.end()) {
-                obj->second((void *) &elem);
+        template<typename Record, std::size_t... Is>
+        void writeColumnsImpl(const std::vector<Record> &records, std::index_sequence<Is...>) {
+            constexpr auto fields = Record::fields();
+            (writeColumn(records, std::get<Is>(fields)), ...);
+        }
+
+        template<typename Record, typename Field>
+        void writeColumn(const std::vector<Record> &records, Field Record::*field) {
+            std::size_t lenOffset = this->size();
+            std::size_t columnLen = 0;
+            write(columnLen);
+
+            for (auto &&record: records) {
+                write(record.*field);
             }
+
+            columnLen = this->size() - lenOffset - sizeof(columnLen);
+            this->patchBytes(lenOffset, reinterpret_cast<const char *>(&columnLen), sizeof(columnLen));
         }
 
-        template<typename T>
-        void writeRegObject(T &elem) {
-            auto obj = m_deserializationTemplate.find(typeid(T));
-            if (obj != m_deserializationTemplate.end()) {
-                obj->second((void *) &elem);
+        template<typename Record, std::size_t... Is>
+        void readColumnsImpl(std::vector<Record> &records, std::size_t first, std::index_sequence<Is...>) {
+            constexpr auto fields = Record::fields();
+            (readColumnInto(records, first, std::get<Is>(fields)), ...);
+        }
+
+        template<typename Record, typename Field>
+        void readColumnInto(std::vector<Record> &records, std::size_t first, Field Record::*field) {
+            std::size_t columnLen = 0;
+            read(columnLen);
+
+            std::size_t columnBegin = this->readOffset();
+            for (std::size_t i = first; i < records.size(); i++) {
+                read(records[i].*field);
             }
+            checkColumnLength(columnBegin, columnLen);
         }
 
-    private:
-        map_type m_serializationTemplate;
-        map_type m_deserializationTemplate;
+        // A column that decodes to a different length than was written would
+        // misalign every column after it.
+        void checkColumnLength(std::size_t columnBegin, std::size_t columnLen) {
+            if (ok() && this->readOffset() - columnBegin != columnLen) {
+                m_status = DecodeStatus::Invalid;
+            }
+        }
+
+        template<typename Variant>
+        bool checkVariantIndex(std::size_t index) {
+            if (m_status != DecodeStatus::Ok) {
+                return false;
+            }
+            if (index >= std::variant_size_v<Variant>) {
+                m_status = DecodeStatus::Invalid;
+                return false;
+            }
+            return true;
+        }
+
+        template<typename Variant, std::size_t... Is>
+        void readVariant(Variant &out, std::size_t index, std::index_sequence<Is...>) {
+            ((index == Is ? readAlternative<Is>(out) : void()), ...);
+        }
+
+        // Decodes into a temporary so a failed read leaves the caller's value intact.
+        template<std::size_t I, typename Variant>
+        void readAlternative(Variant &out) {
+            std::variant_alternative_t<I, Variant> alt{};
+            read(alt);
+            if (ok()) {
+                out.template emplace<I>(std::move(alt));
+            }
+        }
+
+        std::unique_ptr<InstanceTemplates> m_templates;
+        DecodeStatus m_status{DecodeStatus::Ok};
+        std::size_t m_blockBegin{0};
+        bool m_blockOpen{false};
     };
 
     using StaticBinSer = binser::Serializer<binser::polices::StaticStoragePolicy>;
     using DynamicBinSer = binser::Serializer<binser::polices::DynamicStoragePolicy>;
+    using SegmentedBinSer = binser::Serializer<binser::polices::SegmentedStoragePolicy>;
 }
 
 #endif
@@ -0,0 +1,169 @@
+#ifndef BINSER_DELTASNAPSHOT_H
+#define BINSER_DELTASNAPSHOT_H
+
+#include "BinarySerializer.h"
+
+// Incremental snapshots of std::map / std::unordered_map. A delta is laid out as
+// [upsertCount][key, value]... [eraseCount][key]... and is applied on top of the
+// previous snapshot with readDelta(). The changes can come from a DeltaTracker,
+// which records them as the map is mutated, or from diffing against a retained
+// baseline copy.
+namespace binser {
+    namespace detail {
+        template<typename Map, ContainerKind = container_traits<Map>::kind>
+        struct key_set;
+
+        template<typename Map>
+        struct key_set<Map, ContainerKind::Ordered> {
+            using type = std::set<typename Map::key_type, typename Map::key_compare>;
+        };
+
+        template<typename Map>
+        struct key_set<Map, ContainerKind::Unordered> {
+            using type = std::unordered_set<typename Map::key_type, typename Map::hasher, typename Map::key_equal>;
+        };
+
+        template<typename Ser>
+        std::size_t reserveCount(Ser &ser) {
+            std::size_t offset = ser.size();
+            ser.write(std::size_t{0});
+            return offset;
+        }
+
+        template<typename Ser>
+        void patchCount(Ser &ser, std::size_t offset, std::size_t count) {
+            ser.patchBytes(offset, reinterpret_cast<const char *>(&count), sizeof(count));
+        }
+    }
+
+    // Owns a map and remembers which keys were written or erased since the
+    // last commit(). Mutate the map only through this interface.
+    template<typename Map>
+    class DeltaTracker {
+    public:
+        using key_type = typename Map::key_type;
+        using mapped_type = typename Map::mapped_type;
+        using key_set = typename detail::key_set<Map>::type;
+
+        DeltaTracker() = default;
+
+        explicit DeltaTracker(Map map) : m_map(std::move(map)) {
+        }
+
+        const Map &map() const {
+            return m_map;
+        }
+
+        template<typename V>
+        void set(const key_type &key, V &&val) {
+            m_map.insert_or_assign(key, std::forward<V>(val));
+            markDirty(key);
+        }
+
+        // Marks the key as changed and returns its value for in-place modification.
+        mapped_type &update(const key_type &key) {
+            markDirty(key);
+            return m_map[key];
+        }
+
+        bool erase(const key_type &key) {
+            if (m_map.erase(key) == 0) {
+                return false;
+            }
+            m_dirty.erase(key);
+            m_erased.insert(key);
+            return true;
+        }
+
+        const key_set &dirty() const {
+            return m_dirty;
+        }
+
+        const key_set &erased() const {
+            return m_erased;
+        }
+
+        // Call once a delta has been written to start tracking the next one.
+        void commit() {
+            m_dirty.clear();
+            m_erased.clear();
+        }
+
+    private:
+        void markDirty(const key_type &key) {
+            m_dirty.insert(key);
+            m_erased.erase(key);
+        }
+
+        Map m_map;
+        key_set m_dirty;
+        key_set m_erased;
+    };
+
+    template<typename Ser, typename Map>
+    void writeDelta(Ser &ser, const DeltaTracker<Map> &tracker) {
+        ser.write(tracker.dirty().size());
+        for (auto &&key: tracker.dirty()) {
+            ser.write(key);
+            ser.write(tracker.map().at(key));
+        }
+
+        ser.write(tracker.erased().size());
+        for (auto &&key: tracker.erased()) {
+            ser.write(key);
+        }
+    }
+
+    // Diffs `current` against `baseline`, the map as of the previous snapshot.
+    template<typename Ser, typename Map>
+    void writeDelta(Ser &ser, const Map &current, const Map &baseline) {
+        std::size_t countOffset = detail::reserveCount(ser);
+        std::size_t upserts = 0;
+        for (auto &&[key, val]: current) {
+            auto it = baseline.find(key);
+            if (it == baseline.end() || !(it->second == val)) {
+                ser.write(key);
+                ser.write(val);
+                upserts++;
+            }
+        }
+        detail::patchCount(ser, countOffset, upserts);
+
+        countOffset = detail::reserveCount(ser);
+        std::size_t erases = 0;
+        for (auto &&entry: baseline) {
+            if (current.find(entry.first) == current.end()) {
+                ser.write(entry.first);
+                erases++;
+            }
+        }
+        detail::patchCount(ser, countOffset, erases);
+    }
+
+    template<typename Ser, typename Map>
+    void readDelta(Ser &ser, Map &map) {
+        std::size_t upserts = 0;
+        ser.read(upserts);
+        for (std::size_t i = 0; i < upserts && ser.ok(); i++) {
+            typename Map::key_type key;
+            typename Map::mapped_type val;
+            ser.read(key);
+            ser.read(val);
+            if (ser.ok()) {
+                map.insert_or_assign(std::move(key), std::move(val));
+            }
+        }
+
+        std::size_t erases = 0;
+        ser.read(erases);
+        for (std::size_t i = 0; i < erases && ser.ok(); i++) {
+            typename Map::key_type key;
+            ser.read(key);
+            if (ser.ok()) {
+                map.erase(key);
+            }
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,156 @@
+#ifndef BINSER_FIXEDLAYOUT_H
+#define BINSER_FIXEDLAYOUT_H
+
+#include "BinarySerializer.h"
+
+#include <cstddef>
+
+// Compile-time encoding for messages made only of fixed-size fields: integers,
+// enums, bools, std::array of those, and records that declare fields() (see
+// Serializer::writeColumns). The size is a constant and encoding writes into a
+// std::array<std::byte, N> with no bounds checks, so a message can be encoded
+// in a constexpr context, e.g. for golden test vectors.
+//
+// Fields are packed without padding, little-endian; enums with an enum_range use
+// their packed width. On little-endian hosts the bytes are identical to writing
+// the same fields one by one with Serializer.
+// Floating point fields are supported, but not in constant expressions.
+namespace binser::fixed {
+    namespace detail {
+        template<typename T>
+        inline constexpr bool dependent_false_v = false;
+
+        template<typename T, typename = void>
+        struct has_fields : std::false_type {
+        };
+
+        template<typename T>
+        struct has_fields<T, std::void_t<decltype(T::fields())>> : std::true_type {
+        };
+    }
+
+    template<typename T>
+    constexpr std::size_t size_of();
+
+    namespace detail {
+        template<typename T, std::size_t... Is>
+        constexpr std::size_t fieldsSize(std::index_sequence<Is...>) {
+            return (std::size_t{0} + ... + size_of<binser::detail::record_field_t<T, Is>>());
+        }
+    }
+
+    template<typename T>
+    constexpr std::size_t size_of() {
+        if constexpr (binser::detail::has_enum_range<T>::value) {
+            return binser::detail::packed_size<T>();
+        } else if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>) {
+            return sizeof(T);
+        } else if constexpr (binser::detail::is_std_array<T>::value) {
+            return std::tuple_size_v<T> * size_of<typename T::value_type>();
+        } else if constexpr (detail::has_fields<T>::value) {
+            return detail::fieldsSize<T>(std::make_index_sequence<binser::detail::record_field_count_v<T>>{});
+        } else {
+            static_assert(detail::dependent_false_v<T>, "Type does not have a fixed-size layout !");
+            return 0;
+        }
+    }
+
+    template<typename T>
+    inline constexpr std::size_t size_v = size_of<T>();
+
+    template<typename T>
+    constexpr void encodeTo(const T &value, std::byte *out);
+
+    template<typename T>
+    constexpr void decodeFrom(const std::byte *in, T &out);
+
+    namespace detail {
+        template<typename T, std::size_t... Is>
+        constexpr void encodeFields(const T &value, std::byte *out, std::index_sequence<Is...>) {
+            constexpr auto fields = T::fields();
+            ((encodeTo(value.*std::get<Is>(fields), out),
+                    out += size_v<binser::detail::record_field_t<T, Is>>), ...);
+        }
+
+        template<typename T, std::size_t... Is>
+        constexpr void decodeFields(const std::byte *in, T &out, std::index_sequence<Is...>) {
+            constexpr auto fields = T::fields();
+            ((decodeFrom(in, out.*std::get<Is>(fields)),
+                    in += size_v<binser::detail::record_field_t<T, Is>>), ...);
+        }
+    }
+
+    template<typename T>
+    constexpr void encodeTo(const T &value, std::byte *out) {
+        if constexpr (std::is_same_v<T, bool>) {
+            out[0] = std::byte{value ? std::uint8_t{1} : std::uint8_t{0}};
+        } else if constexpr (std::is_integral_v<T>) {
+            auto bits = static_cast<std::make_unsigned_t<T>>(value);
+            for (std::size_t i = 0; i < sizeof(T); i++) {
+                out[i] = static_cast<std::byte>(bits >> (8 * i) & 0xFF);
+            }
+        } else if constexpr (binser::detail::has_enum_range<T>::value) {
+            auto raw = static_cast<std::uint64_t>(value);
+            for (std::size_t i = 0; i < size_v<T>; i++) {
+                out[i] = static_cast<std::byte>(raw >> (8 * i) & 0xFF);
+            }
+        } else if constexpr (std::is_enum_v<T>) {
+            encodeTo(static_cast<std::underlying_type_t<T>>(value), out);
+        } else if constexpr (std::is_floating_point_v<T>) {
+            std::memcpy(out, &value, sizeof(T));
+        } else if constexpr (binser::detail::is_std_array<T>::value) {
+            for (std::size_t i = 0; i < value.size(); i++) {
+                encodeTo(value[i], out + i * size_v<typename T::value_type>);
+            }
+        } else {
+            detail::encodeFields(value, out, std::make_index_sequence<binser::detail::record_field_count_v<T>>{});
+        }
+    }
+
+    template<typename T>
+    constexpr void decodeFrom(const std::byte *in, T &out) {
+        if constexpr (std::is_same_v<T, bool>) {
+            out = in[0] != std::byte{0};
+        } else if constexpr (std::is_integral_v<T>) {
+            std::make_unsigned_t<T> bits = 0;
+            for (std::size_t i = 0; i < sizeof(T); i++) {
+                bits |= static_cast<std::make_unsigned_t<T>>(static_cast<std::uint8_t>(in[i])) << (8 * i);
+            }
+            out = static_cast<T>(bits);
+        } else if constexpr (binser::detail::has_enum_range<T>::value) {
+            std::uint64_t raw = 0;
+            for (std::size_t i = 0; i < size_v<T>; i++) {
+                raw |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(in[i])) << (8 * i);
+            }
+            out = static_cast<T>(raw);
+        } else if constexpr (std::is_enum_v<T>) {
+            std::underlying_type_t<T> raw{};
+            decodeFrom(in, raw);
+            out = static_cast<T>(raw);
+        } else if constexpr (std::is_floating_point_v<T>) {
+            std::memcpy(&out, in, sizeof(T));
+        } else if constexpr (binser::detail::is_std_array<T>::value) {
+            for (std::size_t i = 0; i < out.size(); i++) {
+                decodeFrom(in + i * size_v<typename T::value_type>, out[i]);
+            }
+        } else {
+            detail::decodeFields(in, out, std::make_index_sequence<binser::detail::record_field_count_v<T>>{});
+        }
+    }
+
+    template<typename T>
+    constexpr std::array<std::byte, size_v<T>> encode(const T &value) {
+        std::array<std::byte, size_v<T>> out{};
+        encodeTo(value, out.data());
+        return out;
+    }
+
+    template<typename T>
+    constexpr T decode(const std::array<std::byte, size_v<T>> &bytes) {
+        T out{};
+        decodeFrom(bytes.data(), out);
+        return out;
+    }
+}
+
+#endif
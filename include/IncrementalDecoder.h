@@ -0,0 +1,330 @@
+#ifndef BINSER_INCREMENTALDECODER_H
+#define BINSER_INCREMENTALDECODER_H
+
+#include "BinarySerializer.h"
+
+namespace binser {
+    namespace detail {
+        template<typename T>
+        inline constexpr bool dependent_false_v = false;
+
+        // A Resumable<T> decodes T from the wire format written by Serializer, from
+        // as many bytes as are available. feed() returns false when it runs out of
+        // input and picks up at the same byte on the next call. On completion it
+        // returns true and leaves itself ready to decode the next value. Malformed
+        // input sets `status` and also returns false; the value is then abandoned.
+        template<typename T, typename = void>
+        struct Resumable {
+            static_assert(dependent_false_v<T>, "Type is not supported by IncrementalDecoder !");
+        };
+
+        template<typename T>
+        struct Resumable<T, std::enable_if_t<is_bulk_copyable_v<T> &&
+                                             container_traits<T>::kind == ContainerKind::None &&
+                                             !is_pair<T>::value && !is_packed_v<T>>> {
+            bool feed(const char *&cur, const char *end, T &out, DecodeStatus &) {
+                std::size_t n = std::min<std::size_t>(sizeof(T) - have, end - cur);
+                std::memcpy(reinterpret_cast<char *>(std::addressof(out)) + have, cur, n);
+                cur += n;
+                have += n;
+
+                if (have < sizeof(T)) {
+                    return false;
+                }
+                have = 0;
+                return true;
+            }
+
+            std::size_t have{0};
+        };
+
+        template<typename T>
+        struct Resumable<T, std::enable_if_t<is_packed_v<T>>> {
+            bool feed(const char *&cur, const char *end, T &out, DecodeStatus &status) {
+                std::size_t n = std::min<std::size_t>(bytes.size() - have, end - cur);
+                std::memcpy(bytes.data() + have, cur, n);
+                cur += n;
+                have += n;
+
+                if (have < bytes.size()) {
+                    return false;
+                }
+                have = 0;
+                if (!decodePacked(bytes.data(), out)) {
+                    status = DecodeStatus::Invalid;
+                    return false;
+                }
+                return true;
+            }
+
+            std::array<std::uint8_t, packed_size<T>()> bytes{};
+            std::size_t have{0};
+        };
+
+        template<typename Alloc>
+        struct Resumable<std::vector<bool, Alloc>> {
+            bool feed(const char *&cur, const char *end, std::vector<bool, Alloc> &out, DecodeStatus &status) {
+                if (!haveLen) {
+                    if (!lenState.feed(cur, end, len, status)) {
+                        return false;
+                    }
+                    haveLen = true;
+                }
+
+                for (; got < len && cur != end; cur++) {
+                    auto byte = static_cast<std::uint8_t>(*cur);
+                    std::size_t n = std::min<std::size_t>(8, len - got);
+                    for (std::size_t i = 0; i < n; i++) {
+                        out.push_back((byte >> i) & 1);
+                    }
+                    got += n;
+                }
+
+                if (got < len) {
+                    return false;
+                }
+                *this = Resumable{};
+                return true;
+            }
+
+            Resumable<std::size_t> lenState;
+            std::size_t len{0};
+            std::size_t got{0};
+            bool haveLen{false};
+        };
+
+        template<>
+        struct Resumable<std::string> {
+            bool feed(const char *&cur, const char *end, std::string &out, DecodeStatus &status) {
+                if (!haveLen) {
+                    if (!lenState.feed(cur, end, len, status)) {
+                        return false;
+                    }
+                    haveLen = true;
+                    out.reserve(out.size() + std::min<std::size_t>(len, end - cur));
+                }
+
+                std::size_t n = std::min<std::size_t>(len - got, end - cur);
+                out.append(cur, n);
+                cur += n;
+                got += n;
+
+                if (got < len) {
+                    return false;
+                }
+                *this = Resumable{};
+                return true;
+            }
+
+            Resumable<std::size_t> lenState;
+            std::size_t len{0};
+            std::size_t got{0};
+            bool haveLen{false};
+        };
+
+        template<typename A, typename B>
+        struct Resumable<std::pair<A, B>> {
+            bool feed(const char *&cur, const char *end, std::pair<A, B> &out, DecodeStatus &status) {
+                if (!haveFirst) {
+                    if (!firstState.feed(cur, end, out.first, status)) {
+                        return false;
+                    }
+                    haveFirst = true;
+                }
+                if (!secondState.feed(cur, end, out.second, status)) {
+                    return false;
+                }
+                haveFirst = false;
+                return true;
+            }
+
+            Resumable<A> firstState;
+            Resumable<B> secondState;
+            bool haveFirst{false};
+        };
+
+        template<typename T>
+        struct Resumable<std::optional<T>> {
+            bool feed(const char *&cur, const char *end, std::optional<T> &out, DecodeStatus &status) {
+                if (!haveFlag) {
+                    if (!flagState.feed(cur, end, hasValue, status)) {
+                        return false;
+                    }
+                    haveFlag = true;
+                    if (!hasValue) {
+                        out.reset();
+                        *this = Resumable{};
+                        return true;
+                    }
+                    out.emplace();
+                }
+
+                if (!valueState.feed(cur, end, *out, status)) {
+                    return false;
+                }
+                *this = Resumable{};
+                return true;
+            }
+
+            Resumable<bool> flagState;
+            Resumable<T> valueState;
+            bool hasValue{false};
+            bool haveFlag{false};
+        };
+
+        template<typename Container>
+        struct Resumable<Container, std::enable_if_t<container_traits<Container>::kind != ContainerKind::None &&
+                                                     !container_traits<Container>::mapped &&
+                                                     !is_bool_vector<Container>::value>> {
+            using E = typename Container::value_type;
+
+            bool feed(const char *&cur, const char *end, Container &out, DecodeStatus &status) {
+                if (!haveLen) {
+                    if (!lenState.feed(cur, end, len, status)) {
+                        return false;
+                    }
+                    haveLen = true;
+                }
+
+                while (idx < len) {
+                    if constexpr (is_contiguous_container<Container>::value && is_bulk_copyable_v<E>) {
+                        // Whole elements are copied straight from the input; only an element
+                        // split across two feeds goes through elemState.
+                        std::size_t whole = std::min<std::size_t>(len - idx, (end - cur) / sizeof(E));
+                        if (elemState.have == 0 && whole > 0) {
+                            std::size_t oldSize = out.size();
+                            out.resize(oldSize + whole);
+                            std::memcpy(out.data() + oldSize, cur, whole * sizeof(E));
+                            cur += whole * sizeof(E);
+                            idx += whole;
+                            continue;
+                        }
+                    }
+
+                    if (!elemState.feed(cur, end, elem, status)) {
+                        return false;
+                    }
+                    appendElement(out, std::move(elem));
+                    elem = E{};
+                    idx++;
+                }
+
+                *this = Resumable{};
+                return true;
+            }
+
+            Resumable<std::size_t> lenState;
+            Resumable<E> elemState;
+            E elem{};
+            std::size_t len{0};
+            std::size_t idx{0};
+            bool haveLen{false};
+        };
+
+        template<typename Container>
+        struct Resumable<Container, std::enable_if_t<container_traits<Container>::kind != ContainerKind::None &&
+                                                     container_traits<Container>::mapped>> {
+            using K = typename Container::key_type;
+            using V = typename Container::mapped_type;
+
+            bool feed(const char *&cur, const char *end, Container &out, DecodeStatus &status) {
+                if (!haveLen) {
+                    if (!lenState.feed(cur, end, len, status)) {
+                        return false;
+                    }
+                    haveLen = true;
+                }
+
+                while (idx < len) {
+                    if (!haveKey) {
+                        if (!keyState.feed(cur, end, key, status)) {
+                            return false;
+                        }
+                        haveKey = true;
+                    }
+                    if (!valState.feed(cur, end, val, status)) {
+                        return false;
+                    }
+
+                    appendEntry(out, std::move(key), std::move(val));
+                    key = K{};
+                    val = V{};
+                    haveKey = false;
+                    idx++;
+                }
+
+                *this = Resumable{};
+                return true;
+            }
+
+            Resumable<std::size_t> lenState;
+            Resumable<K> keyState;
+            Resumable<V> valState;
+            K key{};
+            V val{};
+            std::size_t len{0};
+            std::size_t idx{0};
+            bool haveLen{false};
+            bool haveKey{false};
+        };
+    }
+
+    // Decodes a single T from bytes as they arrive, e.g. straight off a socket,
+    // without first buffering the whole message.
+    //
+    //     binser::IncrementalDecoder<std::vector<std::string>> decoder;
+    //     while (!decoder.done() && decoder.ok()) {
+    //         std::size_t n = recv(fd, buf, sizeof(buf), 0);
+    //         decoder.feed(buf, n);
+    //     }
+    template<typename T>
+    class IncrementalDecoder {
+    public:
+        // Consumes bytes until the value is complete and returns how many were
+        // used; bytes past the end of the value are left for the caller.
+        std::size_t feed(const void *bytes, std::size_t sz) {
+            if (m_done || m_status != DecodeStatus::Ok) {
+                return 0;
+            }
+
+            const char *begin = static_cast<const char *>(bytes);
+            const char *cur = begin;
+            m_done = m_state.feed(cur, begin + sz, m_value, m_status);
+            return cur - begin;
+        }
+
+        [[nodiscard]] bool done() const {
+            return m_done;
+        }
+
+        // Once the input is found to be malformed the decoder stops consuming
+        // bytes until reset().
+        [[nodiscard]] DecodeStatus status() const {
+            return m_status;
+        }
+
+        [[nodiscard]] bool ok() const {
+            return m_status == DecodeStatus::Ok;
+        }
+
+        T &value() {
+            assert(m_done && "Value is not fully decoded !");
+            return m_value;
+        }
+
+        void reset() {
+            m_state = detail::Resumable<T>{};
+            m_value = T{};
+            m_done = false;
+            m_status = DecodeStatus::Ok;
+        }
+
+    private:
+        detail::Resumable<T> m_state;
+        T m_value{};
+        bool m_done{false};
+        DecodeStatus m_status{DecodeStatus::Ok};
+    };
+}
+
+#endif
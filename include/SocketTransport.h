@@ -0,0 +1,296 @@
+#ifndef BINSER_SOCKETTRANSPORT_H
+#define BINSER_SOCKETTRANSPORT_H
+
+#include "BinarySerializer.h"
+
+#ifndef BINSER_HAS_IOVEC
+#error "SocketTransport.h requires POSIX vectored I/O"
+#endif
+
+#include <cerrno>
+#include <climits>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace binser {
+    namespace detail {
+        template<typename T, typename = void>
+        struct is_bulk_vector : std::false_type {
+        };
+
+        template<typename T>
+        struct is_bulk_vector<T, std::enable_if_t<is_contiguous_container<T>::value>>
+                : std::bool_constant<is_bulk_copyable_v<typename T::value_type>> {
+        };
+
+        // Drops the first `n` bytes from an iovec array, in place.
+        inline void advanceIovecs(iovec *&iov, int &count, std::size_t n) {
+            while (count > 0 && n >= iov->iov_len) {
+                n -= iov->iov_len;
+                iov++;
+                count--;
+            }
+            if (count > 0) {
+                iov->iov_base = static_cast<char *>(iov->iov_base) + n;
+                iov->iov_len -= n;
+            }
+        }
+    }
+
+    // Produces the same bytes as Serializer, but large std::string and trivially
+    // copyable std::vector payloads are not copied: they are kept as references
+    // to the caller's memory and sent together with the inline bytes by flush().
+    // Referenced payloads must stay alive and unchanged until flush() returns.
+    template<typename StoragePolicy = polices::DynamicStoragePolicy>
+    class VectoredWriter {
+        struct Slice {
+            const char *external;
+            std::size_t offset;
+            std::size_t len;
+        };
+
+    public:
+        explicit VectoredWriter(std::size_t threshold = 4096) : m_threshold(threshold) {
+        }
+
+        template<typename T>
+        void write(const T &elem) {
+            if constexpr (detail::is_bulk_vector<T>::value) {
+                writeReference(elem.data(), elem.size());
+            } else {
+                m_ser.write(elem);
+            }
+        }
+
+        void write(const std::string &str) {
+            writeReference(str.data(), str.size());
+        }
+
+        void write(const char *cstr) {
+            writeReference(cstr, std::strlen(cstr));
+        }
+
+        std::vector<iovec> iovecs() {
+            closeInline();
+
+            std::vector<iovec> out;
+            for (auto &&slice: m_slices) {
+                if (slice.external != nullptr) {
+                    out.push_back(iovec{const_cast<char *>(slice.external), slice.len});
+                } else {
+                    m_ser.forEachSpan(slice.offset, slice.len, [&out](char *span, std::size_t n) {
+                        out.push_back(iovec{span, n});
+                    });
+                }
+            }
+            return out;
+        }
+
+        // Sends everything with as few sendmsg() calls as the kernel allows. Returns
+        // the number of bytes sent, or -1 with errno set.
+        ssize_t flush(int fd) {
+            std::vector<iovec> iov = iovecs();
+            iovec *cur = iov.data();
+            int count = static_cast<int>(iov.size());
+            ssize_t total = 0;
+
+            while (count > 0) {
+                msghdr msg{};
+                msg.msg_iov = cur;
+                msg.msg_iovlen = std::min(count, IOV_MAX);
+
+                ssize_t sent = ::sendmsg(fd, &msg, sendFlags);
+                if (sent < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    return -1;
+                }
+
+                total += sent;
+                detail::advanceIovecs(cur, count, static_cast<std::size_t>(sent));
+            }
+
+            clear();
+            return total;
+        }
+
+        void clear() {
+            m_ser.clear();
+            m_slices.clear();
+            m_inlineBegin = 0;
+        }
+
+    private:
+#ifdef MSG_NOSIGNAL
+        static constexpr int sendFlags = MSG_NOSIGNAL;
+#else
+        static constexpr int sendFlags = 0;
+#endif
+
+        template<typename E>
+        void writeReference(const E *ptr, std::size_t n) {
+            m_ser.write(n);
+            if (n * sizeof(E) < m_threshold) {
+                for (std::size_t i = 0; i < n; i++) {
+                    m_ser.write(ptr[i]);
+                }
+                return;
+            }
+
+            closeInline();
+            m_slices.push_back(Slice{reinterpret_cast<const char *>(ptr), 0, n * sizeof(E)});
+        }
+
+        void closeInline() {
+            if (m_ser.size() > m_inlineBegin) {
+                m_slices.push_back(Slice{nullptr, m_inlineBegin, m_ser.size() - m_inlineBegin});
+                m_inlineBegin = m_ser.size();
+            }
+        }
+
+        Serializer<StoragePolicy> m_ser;
+        std::vector<Slice> m_slices;
+        std::size_t m_inlineBegin{0};
+        std::size_t m_threshold;
+    };
+
+    // Reads values in Serializer's wire format straight from a socket. Small
+    // fields are served from an internal buffer; string and vector bodies are
+    // received directly into the destination with readv(), which also tops up
+    // the buffer with whatever follows them. The destination grows with the
+    // bytes actually received, so a length prefix alone cannot make the reader
+    // allocate more than twice what the peer has sent.
+    class VectoredReader {
+    public:
+        explicit VectoredReader(int fd, std::size_t maxLength = std::size_t{64} << 20)
+                : m_fd(fd), m_buf(16 * 1024), m_maxLength(maxLength) {
+        }
+
+        // Each read returns false on EOF, on a socket error, if a length prefix
+        // exceeds maxLength, or for an enum value outside its enum_range.
+        template<typename T>
+        bool read(T &out) {
+            if constexpr (detail::is_bulk_vector<T>::value) {
+                return readBody(out);
+            } else if constexpr (detail::is_packed_v<T>) {
+                if (!fill(detail::packed_size<T>())) {
+                    return false;
+                }
+                const auto *bytes = reinterpret_cast<const std::uint8_t *>(m_buf.data() + m_begin);
+                m_begin += detail::packed_size<T>();
+                return detail::decodePacked(bytes, out);
+            } else {
+                // Only types Serializer writes as their raw bytes; optional, variant and
+                // tuple are trivially copyable but encoded field by field.
+                static_assert(detail::is_bulk_copyable_v<T>, "Type is not supported by VectoredReader !");
+                if (!fill(sizeof(T))) {
+                    return false;
+                }
+                std::memcpy(std::addressof(out), m_buf.data() + m_begin, sizeof(T));
+                m_begin += sizeof(T);
+                return true;
+            }
+        }
+
+        bool read(std::string &out) {
+            return readBody(out);
+        }
+
+        template<typename T>
+        bool read(std::optional<T> &out) {
+            bool hasValue;
+            if (!read(hasValue)) {
+                return false;
+            }
+            if (!hasValue) {
+                out.reset();
+                return true;
+            }
+            if (!out) {
+                out.emplace();
+            }
+            return read(*out);
+        }
+
+    private:
+        template<typename Container>
+        bool readBody(Container &out) {
+            using E = typename Container::value_type;
+
+            std::size_t len;
+            if (!read(len) || len > m_maxLength / sizeof(E)) {
+                return false;
+            }
+
+            std::size_t want = len * sizeof(E);
+            auto grow = [&out, want](std::size_t bytes) {
+                out.resize((std::min(want, bytes) + sizeof(E) - 1) / sizeof(E));
+            };
+
+            std::size_t buffered = std::min(want, m_end - m_begin);
+            grow(std::max(buffered, m_buf.size()));
+            std::memcpy(out.data(), m_buf.data() + m_begin, buffered);
+            m_begin += buffered;
+
+            std::size_t got = buffered;
+            while (got < want) {
+                if (got == out.size() * sizeof(E)) {
+                    grow(2 * got);
+                }
+                char *dst = reinterpret_cast<char *>(out.data());
+                std::size_t room = out.size() * sizeof(E) - got;
+
+                // Only once the body fits can bytes past it go to the buffer.
+                m_begin = m_end = 0;
+                iovec iov[2] = {{dst + got, room},
+                                {m_buf.data(), m_buf.size()}};
+                ssize_t n = ::readv(m_fd, iov, got + room == want ? 2 : 1);
+                if (n < 0 && errno == EINTR) {
+                    continue;
+                }
+                if (n <= 0) {
+                    return false;
+                }
+
+                std::size_t received = static_cast<std::size_t>(n);
+                if (received > room) {
+                    m_end = received - room;
+                    received = room;
+                }
+                got += received;
+            }
+            return true;
+        }
+
+        bool fill(std::size_t need) {
+            if (m_end - m_begin >= need) {
+                return true;
+            }
+
+            std::memmove(m_buf.data(), m_buf.data() + m_begin, m_end - m_begin);
+            m_end -= m_begin;
+            m_begin = 0;
+
+            while (m_end < need) {
+                ssize_t n = ::read(m_fd, m_buf.data() + m_end, m_buf.size() - m_end);
+                if (n < 0 && errno == EINTR) {
+                    continue;
+                }
+                if (n <= 0) {
+                    return false;
+                }
+                m_end += static_cast<std::size_t>(n);
+            }
+            return true;
+        }
+
+        int m_fd;
+        std::vector<char> m_buf;
+        std::size_t m_begin{0};
+        std::size_t m_end{0};
+        std::size_t m_maxLength;
+    };
+}
+
+#endif
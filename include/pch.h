@@ -6,18 +6,40 @@
 #endif
 
 #include <string>
+#include <cstring>
+#include <cstdint>
+#include <functional>
+#include <atomic>
+#include <mutex>
+#include <algorithm>
 #include <memory>
 #include <array>
 #include <fstream>
 #include <vector>
 #include <unordered_map>
+#include <unordered_set>
+#include <list>
 #include <map>
 #include <set>
 #include <queue>
 #include <stack>
 #include <deque>
+#include <bitset>
 #include <cassert>
 #include <type_traits>
 #include <typeindex>
+#include <tuple>
+#include <utility>
+#include <optional>
+#include <variant>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/uio.h>
+#define BINSER_HAS_IOVEC
+#endif
+
+#if defined(__SSE4_2__)
+#include <nmmintrin.h>
+#endif
 
 #endif
\ No newline at end of file
@@ -0,0 +1,199 @@
+#include <gtest/gtest.h>
+#include <BinarySerializer.h>
+
+static std::size_t allocations = 0;
+
+template<typename T>
+struct CountingAllocator {
+    using value_type = T;
+
+    CountingAllocator() = default;
+
+    template<typename U>
+    CountingAllocator(const CountingAllocator<U> &) {
+    }
+
+    T *allocate(std::size_t n) {
+        allocations++;
+        return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T *ptr, std::size_t n) {
+        std::allocator<T>{}.deallocate(ptr, n);
+    }
+
+    template<typename U>
+    bool operator==(const CountingAllocator<U> &) const {
+        return true;
+    }
+
+    template<typename U>
+    bool operator!=(const CountingAllocator<U> &) const {
+        return false;
+    }
+};
+
+TEST(TestBinSer, DYNAMIC_ASSIGN_OVERWRITES_OK) {
+    binser::DynamicBinSer ser;
+    std::string str = "new";
+    std::vector<int> vec{1, 2, 3};
+
+    ser.write(str);
+    ser.write(vec);
+
+    std::string outStr = "old contents";
+    std::vector<int> outVec{9, 9, 9, 9, 9};
+    ser.readAssign(outStr);
+    ser.readAssign(outVec);
+
+    EXPECT_EQ(outStr, str);
+    EXPECT_EQ(outVec, vec);
+}
+
+TEST(TestBinSer, DYNAMIC_ASSIGN_REUSES_NESTED_BUFFERS_OK) {
+    binser::DynamicBinSer ser;
+    std::vector<std::string> vec;
+    for (int i = 0; i < 100; i++) {
+        vec.push_back(std::string(64, static_cast<char>('a' + i % 26)));
+    }
+
+    ser.write(vec);
+    std::vector<std::string> out;
+    ser.readAssign(out);
+
+    const std::string *outData = out.data();
+    std::vector<const char *> strData;
+    for (auto &&str: out) {
+        strData.push_back(str.data());
+    }
+
+    for (auto &&str: vec) {
+        str.back() = '!';
+    }
+    ser.clear();
+    ser.write(vec);
+    ser.readAssign(out);
+
+    EXPECT_EQ(out, vec);
+    EXPECT_EQ(out.data(), outData);
+    for (std::size_t i = 0; i < out.size(); i++) {
+        EXPECT_EQ(out[i].data(), strData[i]);
+    }
+}
+
+TEST(TestBinSer, DYNAMIC_ASSIGN_RECYCLES_MAP_NODES_OK) {
+    binser::DynamicBinSer ser;
+    std::map<int, std::string> map{{1, std::string(64, 'a')}, {2, std::string(64, 'b')}};
+
+    ser.write(map);
+    std::map<int, std::string> out{{5, "stale"}, {7, std::string(64, 'x')}};
+    const char *nodeData = out.at(7).data();
+    ser.readAssign(out);
+
+    EXPECT_EQ(out, map);
+    EXPECT_EQ(out.at(2).data(), nodeData);
+
+    std::map<int, std::string> grown{{1, "a"}, {2, "b"}, {3, "c"}, {4, "d"}};
+    ser.clear();
+    ser.write(grown);
+    ser.readAssign(out);
+
+    EXPECT_EQ(out, grown);
+}
+
+TEST(TestBinSer, DYNAMIC_ASSIGN_NESTED_OK) {
+    binser::DynamicBinSer ser;
+    std::list<std::pair<std::string, std::optional<std::vector<int>>>> list{
+            {"a", std::vector<int>{1, 2}},
+            {"b", std::nullopt}};
+    std::unordered_map<std::string, int> umap{{"x", 1}, {"y", 2}};
+    std::set<std::string> set{"p", "q"};
+    std::variant<int, std::string> var = std::string("v");
+
+    ser.write(list);
+    ser.write(umap);
+    ser.write(set);
+    ser.write(var);
+
+    decltype(list) outList{{"z", std::nullopt}, {"y", std::vector<int>{3}}, {"x", std::nullopt}};
+    decltype(umap) outUmap{{"stale", 0}};
+    decltype(set) outSet{"r"};
+    decltype(var) outVar = std::string("old");
+    ser.readAssign(outList);
+    ser.readAssign(outUmap);
+    ser.readAssign(outSet);
+    ser.readAssign(outVar);
+
+    EXPECT_EQ(outList, list);
+    EXPECT_EQ(outUmap, umap);
+    EXPECT_EQ(outSet, set);
+    EXPECT_EQ(outVar, var);
+}
+
+TEST(TestBinSer, DYNAMIC_ASSIGN_TRUNCATED_FAIL) {
+    binser::DynamicBinSer ser;
+    std::size_t count = 2;
+    ser.write(count);
+    ser.write(std::string("only one"));
+
+    std::vector<std::string> out{"a", "b", "c", "d"};
+    ser.readAssign(out);
+
+    EXPECT_FALSE(ser.ok());
+    EXPECT_EQ(out.size(), 1u);
+}
+
+TEST(TestBinSer, STATIC_ASSIGN_ARRAYS_OK) {
+    binser::StaticBinSer ser;
+    std::array<std::optional<int>, 2> optionals{1, std::nullopt};
+    std::array<std::array<int, 2>, 3> grid{{{1, 2}, {3, 4}, {5, 6}}};
+
+    ser.write(optionals);
+    ser.write(grid);
+
+    std::array<std::optional<int>, 2> outOptionals{std::nullopt, 9};
+    std::array<std::array<int, 2>, 3> outGrid{};
+    ser.readAssign(outOptionals);
+    ser.readAssign(outGrid);
+
+    EXPECT_TRUE(ser.ok());
+    EXPECT_EQ(ser.remaining(), 0u);
+    EXPECT_EQ(outOptionals, optionals);
+    EXPECT_EQ(outGrid, grid);
+}
+
+TEST(TestBinSer, DYNAMIC_ASSIGN_UNORDERED_STEADY_STATE_NO_ALLOC_OK) {
+    using Map = std::unordered_map<int, int, std::hash<int>, std::equal_to<>,
+            CountingAllocator<std::pair<const int, int>>>;
+    using Set = std::unordered_set<int, std::hash<int>, std::equal_to<>, CountingAllocator<int>>;
+    binser::DynamicBinSer ser;
+    Map map;
+    Set set;
+    for (int i = 0; i < 100; i++) {
+        map[i] = i * i;
+        set.insert(-i);
+    }
+
+    Map outMap;
+    Set outSet;
+    ser.write(map);
+    ser.write(set);
+    ser.readAssign(outMap);
+    ser.readAssign(outSet);
+
+    map.clear();
+    for (int i = 0; i < 100; i++) {
+        map[i + 1'000] = i;
+    }
+    ser.clear();
+    ser.write(map);
+    ser.write(set);
+
+    allocations = 0;
+    ser.readAssign(outMap);
+    ser.readAssign(outSet);
+
+    EXPECT_EQ(allocations, 0u);
+    EXPECT_EQ(outMap, map);
+    EXPECT_EQ(outSet, set);
+}
@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+#include <IncrementalDecoder.h>
+#include <FixedLayout.h>
+
+enum class Level : std::uint32_t {
+    LOW, MEDIUM, HIGH
+};
+
+template<>
+struct binser::enum_range<Level> {
+    static constexpr Level max = Level::HIGH;
+};
+
+TEST(TestBinSer, DYNAMIC_BOOL_VECTOR_PACKED_OK) {
+    binser::DynamicBinSer ser;
+    std::vector<bool> flags;
+    for (int i = 0; i < 10'001; i++) {
+        flags.push_back(i % 3 == 0 || i % 7 == 0);
+    }
+    std::vector<bool> outFlags;
+
+    ser.write(flags);
+    ser.read(outFlags);
+
+    EXPECT_EQ(ser.size(), sizeof(std::size_t) + (flags.size() + 7) / 8);
+    EXPECT_EQ(flags, outFlags);
+}
+
+TEST(TestBinSer, STATIC_BITSET_PACKED_OK) {
+    binser::StaticBinSer ser;
+    std::bitset<100> bits;
+    bits.set(0).set(63).set(64).set(99);
+    std::bitset<100> outBits;
+
+    ser.write(bits);
+    ser.read(outBits);
+
+    EXPECT_EQ(ser.size(), 13u);
+    EXPECT_EQ(bits, outBits);
+}
+
+TEST(TestBinSer, DYNAMIC_RANGED_ENUM_PACKED_OK) {
+    binser::DynamicBinSer ser;
+    Level level = Level::HIGH;
+    Level outLevel = Level::LOW;
+
+    ser.write(level);
+    ser.read(outLevel);
+
+    EXPECT_EQ(ser.size(), 1u);
+    EXPECT_EQ(level, outLevel);
+}
+
+TEST(TestBinSer, DYNAMIC_FLAGS_SHARE_BYTES_OK) {
+    binser::DynamicBinSer ser;
+    bool a = true, b = false, c = true;
+    Level level = Level::MEDIUM;
+    bool d = true;
+
+    ser.writeFlags(a, b, level, c, d);
+
+    bool outA = false, outB = true, outC = false, outD = false;
+    Level outLevel = Level::LOW;
+    ser.readFlags(outA, outB, outLevel, outC, outD);
+
+    EXPECT_EQ(ser.size(), 1u);
+    EXPECT_EQ(a, outA);
+    EXPECT_EQ(b, outB);
+    EXPECT_EQ(c, outC);
+    EXPECT_EQ(d, outD);
+    EXPECT_EQ(level, outLevel);
+}
+
+TEST(TestBinSer, INCREMENTAL_PACKED_TYPES_OK) {
+    binser::DynamicBinSer ser;
+    std::vector<bool> flags{true, false, true, true, false, false, true, false, true};
+    std::bitset<12> bits{0xABC};
+    ser.write(flags);
+    ser.write(bits);
+
+    binser::IncrementalDecoder<std::vector<bool>> flagDecoder;
+    std::size_t used = 0;
+    for (; used < ser.size() && !flagDecoder.done(); used++) {
+        flagDecoder.feed(ser.data() + used, 1);
+    }
+    binser::IncrementalDecoder<std::bitset<12>> bitsDecoder;
+    bitsDecoder.feed(ser.data() + used, ser.size() - used);
+
+    ASSERT_TRUE(flagDecoder.done());
+    ASSERT_TRUE(bitsDecoder.done());
+    EXPECT_EQ(flagDecoder.value(), flags);
+    EXPECT_EQ(bitsDecoder.value(), bits);
+}
+
+TEST(TestBinSer, DYNAMIC_PACKED_VECTOR_ELEMENTS_OK) {
+    binser::DynamicBinSer ser;
+    std::vector<Level> levels{Level::LOW, Level::HIGH, Level::MEDIUM};
+    std::vector<std::bitset<3>> bits{0b101, 0b010};
+    std::vector<Level> outLevels;
+    std::vector<std::bitset<3>> outBits;
+
+    ser.write(levels);
+    ser.write(bits);
+    ser.read(outLevels);
+    ser.read(outBits);
+
+    EXPECT_EQ(ser.size(), 2 * sizeof(std::size_t) + levels.size() + bits.size());
+    EXPECT_EQ(levels, outLevels);
+    EXPECT_EQ(bits, outBits);
+}
+
+TEST(TestBinSer, STATIC_PACKED_ARRAY_MATCHES_FIXED_LAYOUT_OK) {
+    binser::StaticBinSer ser;
+    std::array<Level, 4> levels{Level::HIGH, Level::LOW, Level::MEDIUM, Level::HIGH};
+    std::array<Level, 4> outLevels{};
+
+    ser.write(levels);
+    ser.read(outLevels);
+
+    auto bytes = binser::fixed::encode(levels);
+    ASSERT_EQ(ser.size(), (binser::fixed::size_v<std::array<Level, 4>>));
+    EXPECT_EQ(std::memcmp(ser.data(), bytes.data(), bytes.size()), 0);
+    EXPECT_EQ(levels, outLevels);
+}
+
+TEST(TestBinSer, INCREMENTAL_PACKED_VECTOR_SPLIT_ELEMENT_OK) {
+    binser::DynamicBinSer ser;
+    std::vector<std::bitset<12>> bits{0xABC, 0x123, 0xFFF};
+    ser.write(bits);
+
+    binser::IncrementalDecoder<std::vector<std::bitset<12>>> decoder;
+    std::size_t used = decoder.feed(ser.data(), sizeof(std::size_t) + 3);
+    used += decoder.feed(ser.data() + used, ser.size() - used);
+
+    ASSERT_TRUE(decoder.done());
+    EXPECT_EQ(used, ser.size());
+    EXPECT_EQ(decoder.value(), bits);
+}
+
+TEST(TestBinSer, DYNAMIC_FLAGS_OUT_OF_RANGE_DOES_NOT_SPILL) {
+    binser::DynamicBinSer ser;
+    EXPECT_DEBUG_DEATH(ser.writeFlags(false, static_cast<Level>(7), false), "enum_range");
+
+#ifdef NDEBUG
+    // The level is masked to its two bits, so the trailing bool (bit 3) stays clear.
+    ASSERT_EQ(ser.size(), 1u);
+    EXPECT_EQ(ser.data()[0] & 0x8, 0);
+#endif
+}
+
+TEST(TestBinSer, DYNAMIC_RANGED_ENUM_OUT_OF_RANGE_FAIL) {
+    binser::DynamicBinSer ser;
+    std::uint8_t raw = 3;
+    std::uint8_t flagBits = 0b110;
+    ser.write(raw);
+    ser.write(flagBits);
+
+    Level outLevel = Level::LOW;
+    EXPECT_EQ(ser.tryRead(outLevel), binser::DecodeStatus::Invalid);
+    EXPECT_EQ(outLevel, Level::LOW);
+
+    ser.clearStatus();
+    bool outFlag = false;
+    ser.readFlags(outFlag, outLevel);
+    EXPECT_EQ(ser.status(), binser::DecodeStatus::Invalid);
+
+    binser::IncrementalDecoder<std::vector<Level>> decoder;
+    binser::DynamicBinSer vecSer;
+    vecSer.write(std::size_t{2});
+    vecSer.write(std::uint8_t{1});
+    vecSer.write(raw);
+    decoder.feed(vecSer.data(), vecSer.size());
+    EXPECT_FALSE(decoder.done());
+    EXPECT_EQ(decoder.status(), binser::DecodeStatus::Invalid);
+    EXPECT_EQ(decoder.feed(vecSer.data(), vecSer.size()), 0u);
+}
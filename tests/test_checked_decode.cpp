@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+#include <BinarySerializer.h>
+
+TEST(TestBinSer, DYNAMIC_STORAGE_TRUNCATED_READ_FAIL) {
+    binser::DynamicBinSer ser{};
+    int n = 7;
+    int outN;
+    double outD = 1.0;
+
+    ser.write(n);
+    ser.read(outN);
+    ser.read(outD);
+
+    EXPECT_EQ(n, outN);
+    EXPECT_EQ(outD, 1.0);
+    EXPECT_EQ(ser.status(), binser::DecodeStatus::Truncated);
+}
+
+TEST(TestBinSer, STATIC_STORAGE_TRUNCATED_READ_FAIL) {
+    binser::StaticBinSer ser{};
+    std::string str = "hello";
+    std::string outStr;
+
+    ser.write(str.size());
+    ser.write('h');
+
+    EXPECT_EQ(ser.tryRead(outStr), binser::DecodeStatus::LengthOverflow);
+    EXPECT_TRUE(outStr.empty());
+}
+
+TEST(TestBinSer, DYNAMIC_STORAGE_ABSURD_LENGTH_FAIL) {
+    binser::DynamicBinSer ser{};
+    std::size_t bogus = std::numeric_limits<std::size_t>::max() / 2;
+    std::vector<std::uint64_t> outVec;
+
+    ser.write(bogus);
+    ser.write(std::uint64_t{1});
+
+    EXPECT_EQ(ser.tryRead(outVec), binser::DecodeStatus::LengthOverflow);
+    EXPECT_TRUE(outVec.empty());
+    EXPECT_EQ(outVec.capacity(), 0u);
+}
+
+TEST(TestBinSer, DYNAMIC_STORAGE_NESTED_LENGTH_FAIL) {
+    binser::DynamicBinSer ser{};
+    std::map<int, std::string> map{{1, "one"}, {2, "two"}};
+    std::map<int, std::string> outMap;
+
+    ser.write(map);
+    std::size_t fullSize = ser.size();
+
+    binser::DynamicBinSer truncated{};
+    truncated.writeBytes(ser.data(), fullSize - 2);
+
+    EXPECT_NE(truncated.tryRead(outMap), binser::DecodeStatus::Ok);
+    EXPECT_LE(outMap.size(), 1u);
+}
+
+TEST(TestBinSer, DYNAMIC_STORAGE_STATUS_STICKY_OK) {
+    binser::DynamicBinSer ser{};
+    int outN;
+
+    ser.read(outN);
+    ser.write(5);
+    ser.read(outN);
+    EXPECT_FALSE(ser.ok());
+
+    ser.clearStatus();
+    ser.read(outN);
+    EXPECT_TRUE(ser.ok());
+    EXPECT_EQ(outN, 5);
+}
+
+TEST(TestBinSer, DYNAMIC_STORAGE_INVALID_VARIANT_INDEX_FAIL) {
+    binser::DynamicBinSer ser;
+    std::size_t index = 7;
+    ser.write(index);
+    ser.write(index);
+
+    std::variant<int, std::string> outVar = 5;
+    EXPECT_EQ(ser.tryRead(outVar), binser::DecodeStatus::Invalid);
+    EXPECT_EQ(std::get<int>(outVar), 5);
+
+    ser.clearStatus();
+    ser.readAssign(outVar);
+    EXPECT_EQ(ser.status(), binser::DecodeStatus::Invalid);
+}
+
+TEST(TestBinSer, DYNAMIC_STORAGE_STRING_BODY_OK) {
+    binser::DynamicBinSer ser;
+    std::string str(10'000, 'q');
+    ser.write(str);
+
+    std::string outStr = "prefix";
+    ser.read(outStr);
+
+    EXPECT_TRUE(ser.ok());
+    EXPECT_EQ(outStr, "prefix" + str);
+}
+
+TEST(TestBinSer, DYNAMIC_STORAGE_TRUNCATED_OPTIONAL_VARIANT_FAIL) {
+    binser::DynamicBinSer ser;
+    std::optional<int> outOpt = 5;
+    EXPECT_EQ(ser.tryRead(outOpt), binser::DecodeStatus::Truncated);
+    EXPECT_EQ(outOpt, 5);
+
+    ser.clearStatus();
+    ser.readAssign(outOpt);
+    EXPECT_EQ(ser.status(), binser::DecodeStatus::Truncated);
+    EXPECT_EQ(outOpt, 5);
+
+    ser.clearStatus();
+    std::size_t index = 1;
+    ser.write(index);
+    std::variant<int, std::string> outVar = 7;
+    EXPECT_EQ(ser.tryRead(outVar), binser::DecodeStatus::Truncated);
+    EXPECT_EQ(std::get<int>(outVar), 7);
+}
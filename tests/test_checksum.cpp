@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include <BinarySerializer.h>
+
+TEST(TestBinSer, CRC32C_KNOWN_VECTOR_OK) {
+    const char *input = "123456789";
+
+    EXPECT_EQ(binser::checksum::crc32c(input, std::strlen(input)), 0xE3069283u);
+    EXPECT_EQ(binser::checksum::crc32c(input, 0), 0u);
+}
+
+TEST(TestBinSer, CRC32C_INCREMENTAL_OK) {
+    const char *input = "hello binary serialization world";
+    std::size_t len = std::strlen(input);
+
+    std::uint32_t whole = binser::checksum::crc32c(input, len);
+    std::uint32_t part = binser::checksum::crc32c(input, 5);
+    part = binser::checksum::crc32c(input + 5, len - 5, part);
+
+    EXPECT_EQ(whole, part);
+}
+
+TEST(TestBinSer, DYNAMIC_STORAGE_BLOCK_CHECKSUM_OK) {
+    binser::DynamicBinSer ser{};
+    std::vector<std::string> vec{"one", "two", "three"};
+    int n = 42;
+
+    ser.beginBlock();
+    ser.write(vec);
+    ser.write(n);
+    ser.endBlock();
+
+    ASSERT_TRUE(ser.verifyBlock());
+
+    std::vector<std::string> outVec;
+    int outN;
+    ser.read(outVec);
+    ser.read(outN);
+
+    EXPECT_EQ(vec, outVec);
+    EXPECT_EQ(n, outN);
+}
+
+TEST(TestBinSer, STATIC_STORAGE_BLOCK_CHECKSUM_OK) {
+    binser::StaticBinSer ser{};
+    std::string str = "checksummed";
+    std::string outStr;
+
+    ser.beginBlock();
+    ser.write(str);
+    ser.endBlock();
+
+    ASSERT_TRUE(ser.verifyBlock());
+    ser.read(outStr);
+
+    EXPECT_EQ(str, outStr);
+}
+
+TEST(TestBinSer, DYNAMIC_STORAGE_BLOCK_CHECKSUM_CORRUPT_FAIL) {
+    binser::DynamicBinSer ser{};
+    std::string str = "payload";
+
+    ser.beginBlock();
+    ser.write(str);
+    ser.endBlock();
+
+    ser.data()[binser::DynamicBinSer::blockHeaderSize + sizeof(std::size_t)] ^= 0x01;
+
+    EXPECT_FALSE(ser.verifyBlock());
+    EXPECT_EQ(ser.readOffset(), 0u);
+}
+
+TEST(TestBinSer, DYNAMIC_STORAGE_BLOCK_CHECKSUM_TRUNCATED_FAIL) {
+    binser::DynamicBinSer ser{};
+    std::size_t bogusLen = 1'000'000;
+    std::uint32_t crc = 0;
+
+    ser.write(bogusLen);
+    ser.write(crc);
+
+    EXPECT_FALSE(ser.verifyBlock());
+}
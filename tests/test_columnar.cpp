@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include <BinarySerializer.h>
+
+struct Sample {
+    int id{};
+    double value{};
+    std::string tag;
+
+    static constexpr auto fields() {
+        return std::make_tuple(&Sample::id, &Sample::value, &Sample::tag);
+    }
+
+    bool operator==(const Sample &other) const {
+        return id == other.id && value == other.value && tag == other.tag;
+    }
+};
+
+static std::vector<Sample> makeSamples(int count) {
+    std::vector<Sample> samples;
+    for (int i = 0; i < count; i++) {
+        samples.push_back({i, i * 0.5, "tag" + std::to_string(i % 7)});
+    }
+    return samples;
+}
+
+TEST(TestBinSer, DYNAMIC_COLUMNAR_ROUNDTRIP_OK) {
+    binser::DynamicBinSer ser;
+    std::vector<Sample> samples = makeSamples(1000);
+    std::vector<Sample> outSamples;
+
+    ser.writeColumns(samples);
+    ser.readColumns(outSamples);
+
+    EXPECT_EQ(samples, outSamples);
+}
+
+TEST(TestBinSer, STATIC_COLUMNAR_ROUNDTRIP_OK) {
+    binser::StaticBinSer ser;
+    std::vector<Sample> samples = makeSamples(10);
+    std::vector<Sample> outSamples;
+
+    ser.writeColumns(samples);
+    ser.readColumns(outSamples);
+
+    EXPECT_EQ(samples, outSamples);
+}
+
+TEST(TestBinSer, DYNAMIC_COLUMNAR_SINGLE_COLUMN_OK) {
+    binser::DynamicBinSer ser;
+    std::vector<Sample> samples = makeSamples(1000);
+    int trailer = 42;
+
+    ser.writeColumns(samples);
+    ser.write(trailer);
+
+    std::vector<double> values;
+    int outTrailer;
+    ser.readColumn<Sample, 1>(values);
+    ser.read(outTrailer);
+
+    ASSERT_EQ(values.size(), samples.size());
+    for (std::size_t i = 0; i < samples.size(); i++) {
+        EXPECT_EQ(values[i], samples[i].value);
+    }
+    EXPECT_EQ(outTrailer, trailer);
+}
+
+TEST(TestBinSer, DYNAMIC_COLUMNAR_STRING_COLUMN_OK) {
+    binser::DynamicBinSer ser;
+    std::vector<Sample> samples = makeSamples(50);
+
+    ser.writeColumns(samples);
+
+    std::vector<std::string> tags;
+    ser.readColumn<Sample, 2>(tags);
+
+    ASSERT_EQ(tags.size(), samples.size());
+    for (std::size_t i = 0; i < samples.size(); i++) {
+        EXPECT_EQ(tags[i], samples[i].tag);
+    }
+}
+
+TEST(TestBinSer, DYNAMIC_COLUMNAR_LENGTH_MISMATCH_FAIL) {
+    binser::DynamicBinSer ser;
+    std::vector<Sample> samples = makeSamples(10);
+    ser.writeColumns(samples);
+
+    // The id column holds 10 ints; claim one more byte than that.
+    std::size_t columnLen = samples.size() * sizeof(int) + 1;
+    ser.patchBytes(sizeof(std::size_t), reinterpret_cast<const char *>(&columnLen), sizeof(columnLen));
+
+    std::vector<Sample> outSamples;
+    ser.readColumns(outSamples);
+    EXPECT_EQ(ser.status(), binser::DecodeStatus::Invalid);
+
+    std::vector<int> ids;
+    ser.clear();
+    ser.clearStatus();
+    ser.writeColumns(samples);
+    ser.patchBytes(sizeof(std::size_t), reinterpret_cast<const char *>(&columnLen), sizeof(columnLen));
+    ser.readColumn<Sample, 0>(ids);
+    EXPECT_EQ(ser.status(), binser::DecodeStatus::Invalid);
+}
+
+TEST(TestBinSer, DYNAMIC_COLUMNAR_ABSURD_COUNT_FAIL) {
+    binser::DynamicBinSer ser;
+    // 10 Samples need at least 10 * (4 + 8 + 8) bytes; only 80 follow.
+    std::size_t count = 10;
+    ser.write(count);
+    for (int i = 0; i < 10; i++) {
+        ser.write(std::size_t{0});
+    }
+
+    std::vector<Sample> outSamples;
+    ser.readColumns(outSamples);
+
+    EXPECT_EQ(ser.status(), binser::DecodeStatus::LengthOverflow);
+    EXPECT_TRUE(outSamples.empty());
+}
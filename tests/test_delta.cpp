@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#include <DeltaSnapshot.h>
+
+TEST(TestBinSer, DELTA_TRACKER_UNORDERED_MAP_OK) {
+    std::unordered_map<int, std::string> base{{1, "one"}, {2, "two"}, {3, "three"}};
+    binser::DeltaTracker<std::unordered_map<int, std::string>> tracker{base};
+    std::unordered_map<int, std::string> replica = base;
+
+    tracker.set(2, std::string{"TWO"});
+    tracker.update(4) = "four";
+    tracker.erase(3);
+
+    binser::DynamicBinSer ser;
+    binser::writeDelta(ser, tracker);
+    tracker.commit();
+    binser::readDelta(ser, replica);
+
+    EXPECT_EQ(replica, tracker.map());
+    EXPECT_TRUE(tracker.dirty().empty());
+    EXPECT_TRUE(tracker.erased().empty());
+}
+
+TEST(TestBinSer, DELTA_TRACKER_ERASE_THEN_SET_OK) {
+    binser::DeltaTracker<std::map<std::string, int>> tracker{{{"a", 1}, {"b", 2}}};
+    std::map<std::string, int> replica = tracker.map();
+
+    tracker.erase("a");
+    tracker.set("a", 10);
+    tracker.erase("b");
+
+    binser::DynamicBinSer ser;
+    binser::writeDelta(ser, tracker);
+    binser::readDelta(ser, replica);
+
+    EXPECT_EQ(replica, tracker.map());
+    EXPECT_EQ(tracker.dirty().size(), 1u);
+    EXPECT_EQ(tracker.erased().size(), 1u);
+}
+
+TEST(TestBinSer, DELTA_DIFF_AGAINST_BASELINE_OK) {
+    std::map<int, int> baseline;
+    for (int i = 0; i < 10'000; i++) {
+        baseline[i] = i;
+    }
+    std::map<int, int> current = baseline;
+    current[5] = -5;
+    current.erase(7);
+    current[20'000] = 1;
+
+    binser::DynamicBinSer full;
+    full.write(current);
+    binser::DynamicBinSer delta;
+    binser::writeDelta(delta, current, baseline);
+
+    std::map<int, int> replica = baseline;
+    binser::readDelta(delta, replica);
+
+    EXPECT_EQ(replica, current);
+    EXPECT_LT(delta.size() * 100, full.size());
+}
+
+TEST(TestBinSer, DELTA_TRUNCATED_STOPS_OK) {
+    binser::DynamicBinSer ser;
+    std::size_t bogus = 1'000'000'000;
+    ser.write(bogus);
+    ser.write(1);
+
+    std::map<int, int> replica;
+    binser::readDelta(ser, replica);
+
+    EXPECT_FALSE(ser.ok());
+    EXPECT_TRUE(replica.empty());
+}
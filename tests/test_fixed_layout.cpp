@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+#include <FixedLayout.h>
+
+enum class Side : std::uint8_t {
+    BUY = 1, SELL = 2
+};
+
+struct QuoteHeader {
+    std::uint32_t seq{};
+    std::uint16_t type{};
+    Side side{};
+    bool last{};
+    std::array<char, 4> symbol{};
+    std::int64_t price{};
+
+    static constexpr auto fields() {
+        return std::make_tuple(&QuoteHeader::seq, &QuoteHeader::type, &QuoteHeader::side,
+                               &QuoteHeader::last, &QuoteHeader::symbol, &QuoteHeader::price);
+    }
+};
+
+static_assert(binser::fixed::size_v<QuoteHeader> == 20);
+static_assert(binser::fixed::size_v<std::array<QuoteHeader, 3>> == 60);
+
+constexpr QuoteHeader kGoldenHeader{0x01020304, 0x0506, Side::SELL, true, {'A', 'B', 'C', 'D'}, -2};
+constexpr auto kGoldenBytes = binser::fixed::encode(kGoldenHeader);
+
+static_assert(kGoldenBytes[0] == std::byte{0x04} && kGoldenBytes[3] == std::byte{0x01});
+static_assert(kGoldenBytes[4] == std::byte{0x06} && kGoldenBytes[5] == std::byte{0x05});
+static_assert(kGoldenBytes[6] == std::byte{0x02} && kGoldenBytes[7] == std::byte{0x01});
+static_assert(kGoldenBytes[8] == std::byte{'A'} && kGoldenBytes[11] == std::byte{'D'});
+static_assert(kGoldenBytes[12] == std::byte{0xFE} && kGoldenBytes[19] == std::byte{0xFF});
+static_assert(binser::fixed::decode<QuoteHeader>(kGoldenBytes).seq == kGoldenHeader.seq);
+static_assert(binser::fixed::decode<QuoteHeader>(kGoldenBytes).price == kGoldenHeader.price);
+
+TEST(TestBinSer, FIXED_LAYOUT_ROUNDTRIP_OK) {
+    QuoteHeader header{42, 7, Side::BUY, false, {'X', 'Y', 'Z', '\0'}, 123456789};
+
+    auto bytes = binser::fixed::encode(header);
+    QuoteHeader outHeader = binser::fixed::decode<QuoteHeader>(bytes);
+
+    EXPECT_EQ(header.seq, outHeader.seq);
+    EXPECT_EQ(header.type, outHeader.type);
+    EXPECT_EQ(header.side, outHeader.side);
+    EXPECT_EQ(header.last, outHeader.last);
+    EXPECT_EQ(header.symbol, outHeader.symbol);
+    EXPECT_EQ(header.price, outHeader.price);
+}
+
+TEST(TestBinSer, FIXED_LAYOUT_MATCHES_SERIALIZER_OK) {
+    binser::DynamicBinSer ser;
+    QuoteHeader header{42, 7, Side::BUY, true, {'X', 'Y', 'Z', 'W'}, -5};
+
+    ser.write(header.seq);
+    ser.write(header.type);
+    ser.write(header.side);
+    ser.write(header.last);
+    ser.write(header.symbol);
+    ser.write(header.price);
+
+    auto bytes = binser::fixed::encode(header);
+
+    ASSERT_EQ(ser.size(), bytes.size());
+    EXPECT_EQ(std::memcmp(ser.data(), bytes.data(), bytes.size()), 0);
+}
+
+TEST(TestBinSer, FIXED_LAYOUT_THROUGH_SERIALIZER_OK) {
+    binser::DynamicBinSer ser;
+    QuoteHeader header{1, 2, Side::SELL, true, {'Q', 'Q', 'Q', 'Q'}, 3};
+
+    ser.write(binser::fixed::encode(header));
+
+    std::array<std::byte, binser::fixed::size_v<QuoteHeader>> bytes{};
+    ser.read(bytes);
+
+    EXPECT_EQ(binser::fixed::decode<QuoteHeader>(bytes).price, header.price);
+}
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+#include <IncrementalDecoder.h>
+
+template<typename T>
+static void feedInChunks(binser::IncrementalDecoder<T> &decoder, binser::DynamicBinSer &ser, std::size_t chunk) {
+    const char *bytes = ser.data();
+    std::size_t sz = ser.size();
+
+    for (std::size_t off = 0; off < sz && !decoder.done(); off += chunk) {
+        std::size_t n = std::min(chunk, sz - off);
+        EXPECT_EQ(decoder.feed(bytes + off, n), n);
+    }
+}
+
+TEST(TestBinSer, INCREMENTAL_PRIMITIVE_BYTE_BY_BYTE_OK) {
+    binser::DynamicBinSer ser;
+    double d = 3.25;
+    ser.write(d);
+
+    binser::IncrementalDecoder<double> decoder;
+    feedInChunks(decoder, ser, 1);
+
+    ASSERT_TRUE(decoder.done());
+    EXPECT_EQ(decoder.value(), d);
+}
+
+TEST(TestBinSer, INCREMENTAL_VECTOR_OF_STRINGS_OK) {
+    binser::DynamicBinSer ser;
+    std::vector<std::string> vec{"hello", "", "incremental", "world"};
+    ser.write(vec);
+
+    for (std::size_t chunk: {1u, 3u, 7u, 64u}) {
+        binser::IncrementalDecoder<std::vector<std::string>> decoder;
+        feedInChunks(decoder, ser, chunk);
+
+        ASSERT_TRUE(decoder.done());
+        EXPECT_EQ(decoder.value(), vec);
+    }
+}
+
+TEST(TestBinSer, INCREMENTAL_BULK_VECTOR_OK) {
+    binser::DynamicBinSer ser;
+    std::vector<int> vec(10'000);
+    for (int i = 0; i < 10'000; i++) {
+        vec[i] = i * 3;
+    }
+    ser.write(vec);
+
+    binser::IncrementalDecoder<std::vector<int>> decoder;
+    feedInChunks(decoder, ser, 1021);
+
+    ASSERT_TRUE(decoder.done());
+    EXPECT_EQ(decoder.value(), vec);
+}
+
+TEST(TestBinSer, INCREMENTAL_MAP_OK) {
+    binser::DynamicBinSer ser;
+    std::map<std::string, std::vector<int>> map{{"a", {1, 2}}, {"b", {}}, {"c", {3}}};
+    ser.write(map);
+
+    binser::IncrementalDecoder<std::map<std::string, std::vector<int>>> decoder;
+    feedInChunks(decoder, ser, 5);
+
+    ASSERT_TRUE(decoder.done());
+    EXPECT_EQ(decoder.value(), map);
+}
+
+TEST(TestBinSer, INCREMENTAL_LEAVES_TRAILING_BYTES_OK) {
+    binser::DynamicBinSer ser;
+    std::string first = "first";
+    std::string second = "second";
+    ser.write(first);
+    ser.write(second);
+
+    binser::IncrementalDecoder<std::string> decoder;
+    std::size_t used = decoder.feed(ser.data(), ser.size());
+
+    ASSERT_TRUE(decoder.done());
+    EXPECT_EQ(decoder.value(), first);
+
+    decoder.reset();
+    decoder.feed(ser.data() + used, ser.size() - used);
+
+    ASSERT_TRUE(decoder.done());
+    EXPECT_EQ(decoder.value(), second);
+}
+
+TEST(TestBinSer, INCREMENTAL_OPTIONAL_OK) {
+    binser::DynamicBinSer ser;
+    std::vector<std::optional<int>> vec{42, std::nullopt, -1};
+    ser.write(vec);
+
+    for (std::size_t chunk: {1u, 2u, 64u}) {
+        binser::IncrementalDecoder<std::vector<std::optional<int>>> decoder;
+        feedInChunks(decoder, ser, chunk);
+
+        ASSERT_TRUE(decoder.done());
+        EXPECT_EQ(decoder.value(), vec);
+    }
+}
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+#include <BinarySerializer.h>
+
+TEST(TestBinSer, DYNAMIC_INDEXED_RANDOM_ACCESS_OK) {
+    binser::DynamicBinSer ser;
+    std::vector<std::string> vec;
+    for (int i = 0; i < 100'000; i++) {
+        vec.push_back("entry-" + std::to_string(i));
+    }
+    int trailer = 7;
+
+    ser.writeIndexed(vec);
+    ser.write(trailer);
+
+    auto view = ser.readIndexed<std::string>();
+    int outTrailer;
+    ser.read(outTrailer);
+
+    ASSERT_EQ(view.size(), vec.size());
+    EXPECT_EQ(view[0], vec[0]);
+    EXPECT_EQ(view[54'321], vec[54'321]);
+    EXPECT_EQ(view[99'999], vec[99'999]);
+    EXPECT_EQ(outTrailer, trailer);
+    EXPECT_TRUE(ser.ok());
+}
+
+TEST(TestBinSer, SEGMENTED_INDEXED_NESTED_RECORDS_OK) {
+    binser::SegmentedBinSer ser;
+    std::vector<std::pair<int, std::vector<std::string>>> vec;
+    for (int i = 0; i < 5'000; i++) {
+        vec.push_back({i, std::vector<std::string>(i % 5, std::to_string(i))});
+    }
+
+    ser.writeIndexed(vec);
+    auto view = ser.readIndexed<std::pair<int, std::vector<std::string>>>();
+
+    ASSERT_EQ(view.size(), vec.size());
+    for (std::size_t i: {0u, 1u, 4'444u, 4'999u}) {
+        EXPECT_EQ(view[i], vec[i]);
+    }
+}
+
+TEST(TestBinSer, DYNAMIC_INDEXED_CORRUPT_OFFSETS_FAIL) {
+    binser::DynamicBinSer ser;
+    std::vector<std::string> vec{"a", "bb", "ccc"};
+
+    int trailer = 7;
+    ser.writeIndexed(vec);
+    ser.write(trailer);
+    std::size_t bogus = 1'000'000;
+    ser.patchBytes(sizeof(std::size_t) * 3, reinterpret_cast<const char *>(&bogus), sizeof(bogus));
+
+    auto view = ser.readIndexed<std::string>();
+    std::string out;
+
+    ASSERT_EQ(view.size(), 3u);
+    EXPECT_TRUE(view.get(0, out));
+    EXPECT_EQ(out, "a");
+    EXPECT_FALSE(view.get(2, out));
+
+    int outTrailer = 0;
+    ser.read(outTrailer);
+    EXPECT_TRUE(ser.ok());
+    EXPECT_EQ(outTrailer, trailer);
+}
+
+TEST(TestBinSer, DYNAMIC_INDEXED_MALFORMED_ELEMENT_KEEPS_STATUS_OK) {
+    binser::DynamicBinSer ser;
+    std::vector<std::string> vec{"a", "bb"};
+    int trailer = 7;
+    ser.writeIndexed(vec);
+    ser.write(trailer);
+    std::size_t bogus = 1'000'000;
+    std::size_t lenOffset = sizeof(std::size_t) * 4 + sizeof(std::size_t) + 1;
+    ser.patchBytes(lenOffset, reinterpret_cast<const char *>(&bogus), sizeof(bogus));
+
+    auto view = ser.readIndexed<std::string>();
+    std::string out;
+    EXPECT_FALSE(view.get(1, out));
+
+    int outTrailer = 0;
+    ser.read(outTrailer);
+    EXPECT_TRUE(ser.ok());
+    EXPECT_EQ(outTrailer, trailer);
+}
+
+TEST(TestBinSer, DYNAMIC_INDEXED_GET_OVERWRITES_OK) {
+    binser::DynamicBinSer ser;
+    std::vector<std::string> vec{"a", "bb"};
+    ser.writeIndexed(vec);
+
+    auto view = ser.readIndexed<std::string>();
+    std::string out = "zz";
+
+    EXPECT_TRUE(view.get(1, out));
+    EXPECT_EQ(out, "bb");
+}
+
+TEST(TestBinSer, DYNAMIC_INDEXED_TRUNCATED_FAIL) {
+    binser::DynamicBinSer ser;
+    std::size_t count = 1'000;
+    ser.write(count);
+    ser.write(std::size_t{0});
+
+    auto view = ser.readIndexed<std::string>();
+
+    EXPECT_TRUE(view.empty());
+    EXPECT_FALSE(ser.ok());
+}
@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+#include <BinarySerializer.h>
+#include <thread>
+
+namespace {
+    struct Order {
+        std::string symbol;
+        std::uint64_t quantity{};
+    };
+
+    binser::CodecRegistry<binser::DynamicBinSer> &orderRegistry() {
+        static bool registered = [] {
+            auto &registry = binser::CodecRegistry<binser::DynamicBinSer>::instance();
+            registry.define<Order>(
+                    [](binser::DynamicBinSer &ser, const Order &order) {
+                        ser.write(order.symbol);
+                        ser.write(order.quantity);
+                    },
+                    [](binser::DynamicBinSer &ser, Order &order) {
+                        ser.read(order.symbol);
+                        ser.read(order.quantity);
+                    });
+            registry.freeze();
+            return true;
+        }();
+        (void) registered;
+        return binser::CodecRegistry<binser::DynamicBinSer>::instance();
+    }
+
+    template<int N>
+    struct Tagged {
+        int value{};
+    };
+
+    template<int... Ns>
+    void defineTagged(binser::CodecRegistry<binser::SegmentedBinSer> &registry, std::integer_sequence<int, Ns...>) {
+        (registry.define<Tagged<Ns>>(
+                [](binser::SegmentedBinSer &ser, const Tagged<Ns> &tagged) { ser.write(tagged.value); },
+                [](binser::SegmentedBinSer &ser, Tagged<Ns> &tagged) { ser.read(tagged.value); }), ...);
+    }
+}
+
+TEST(TestBinSer, CODEC_REGISTRY_SHARED_ACROSS_INSTANCES_OK) {
+    ASSERT_TRUE(orderRegistry().frozen());
+    Order order{"ACME", 100};
+
+    binser::DynamicBinSer writer;
+    writer.writeRegObject(order);
+
+    binser::DynamicBinSer reader;
+    reader.writeBytes(writer.data(), writer.size());
+    Order outOrder;
+    reader.readRegObject(outOrder);
+
+    EXPECT_EQ(order.symbol, outOrder.symbol);
+    EXPECT_EQ(order.quantity, outOrder.quantity);
+}
+
+TEST(TestBinSer, CODEC_REGISTRY_UNKNOWN_TYPE_FAIL) {
+    binser::DynamicBinSer ser;
+    struct Unregistered {
+        int n;
+    } value{1};
+
+    EXPECT_FALSE(orderRegistry().write(ser, value));
+    EXPECT_EQ(ser.size(), 0u);
+}
+
+TEST(TestBinSer, CODEC_REGISTRY_INSTANCE_OVERRIDE_OK) {
+    orderRegistry();
+    binser::DynamicBinSer ser;
+    Order order{"OVERRIDE", 1};
+
+    ser.defineTemplateWrite(typeid(Order), [&ser](void *obj) {
+        ser.write(static_cast<Order *>(obj)->symbol);
+    });
+    ser.writeRegObject(order);
+
+    std::string outSymbol;
+    ser.read(outSymbol);
+    EXPECT_EQ(outSymbol, order.symbol);
+    EXPECT_EQ(ser.remaining(), 0u);
+}
+
+TEST(TestBinSer, CODEC_REGISTRY_CONCURRENT_LOOKUPS_OK) {
+    orderRegistry();
+    std::vector<std::thread> threads;
+    std::atomic<int> mismatches{0};
+
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&mismatches, t] {
+            for (int i = 0; i < 1000; i++) {
+                Order order{"T" + std::to_string(t), static_cast<std::uint64_t>(i)};
+                binser::DynamicBinSer ser;
+                ser.writeRegObject(order);
+
+                Order outOrder;
+                ser.readRegObject(outOrder);
+                if (outOrder.symbol != order.symbol || outOrder.quantity != order.quantity) {
+                    mismatches++;
+                }
+            }
+        });
+    }
+    for (auto &&thread: threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(mismatches.load(), 0);
+}
+
+TEST(TestBinSer, CODEC_REGISTRY_DEFINE_AFTER_FREEZE_FAIL) {
+    auto &registry = orderRegistry();
+    bool defined = registry.define<Order>(
+            [](binser::DynamicBinSer &ser, const Order &order) { ser.write(order.quantity); },
+            [](binser::DynamicBinSer &ser, Order &order) { ser.read(order.quantity); });
+    EXPECT_FALSE(defined);
+
+    binser::DynamicBinSer ser;
+    Order order{"ACME", 7};
+    ser.writeRegObject(order);
+    Order outOrder;
+    ser.readRegObject(outOrder);
+
+    EXPECT_EQ(outOrder.symbol, order.symbol);
+    EXPECT_EQ(outOrder.quantity, order.quantity);
+}
+
+TEST(TestBinSer, CODEC_REGISTRY_LOOKUP_DURING_DEFINE_OK) {
+    binser::CodecRegistry<binser::SegmentedBinSer> registry;
+    defineTagged(registry, std::integer_sequence<int, 0>{});
+    std::atomic<bool> stop{false};
+    std::atomic<int> mismatches{0};
+
+    std::thread reader([&] {
+        while (!stop.load()) {
+            binser::SegmentedBinSer ser;
+            Tagged<0> tagged{42};
+            Tagged<0> outTagged{};
+            registry.write(ser, tagged);
+            registry.read(ser, outTagged);
+            if (outTagged.value != tagged.value) {
+                mismatches++;
+            }
+        }
+    });
+    defineTagged(registry, std::make_integer_sequence<int, 64>{});
+    stop.store(true);
+    reader.join();
+
+    EXPECT_EQ(mismatches.load(), 0);
+}
@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+#include <BinarySerializer.h>
+
+TEST(TestBinSer, SEGMENTED_STORAGE_INT_OK) {
+    binser::SegmentedBinSer ser{};
+    int n = 100;
+    int outN;
+
+    ser.write(n);
+    ser.read(outN);
+
+    EXPECT_EQ(n, outN);
+}
+
+TEST(TestBinSer, SEGMENTED_STORAGE_CROSS_SEGMENT_OK) {
+    binser::SegmentedBinSer ser{};
+    std::vector<std::string> vec;
+    for (int i = 0; i < 20'000; i++) {
+        vec.push_back("value-" + std::to_string(i));
+    }
+    std::vector<int> ints(100'000, 7);
+    std::vector<std::string> outVec;
+    std::vector<int> outInts;
+
+    ser.write(vec);
+    ser.write(ints);
+    ser.read(outVec);
+    ser.read(outInts);
+
+    EXPECT_GT(ser.capacity(), binser::polices::SegmentedStoragePolicy::segmentSize);
+    EXPECT_EQ(vec, outVec);
+    EXPECT_EQ(ints, outInts);
+    EXPECT_TRUE(ser.ok());
+}
+
+TEST(TestBinSer, SEGMENTED_STORAGE_NEVER_COPIES_OK) {
+    binser::Serializer<binser::polices::SegmentedStoragePolicy, binser::polices::CountingStatsPolicy> ser{};
+    std::vector<char> blob(3 * binser::polices::SegmentedStoragePolicy::segmentSize, 'x');
+
+    ser.write(blob);
+
+    EXPECT_GT(ser.stats().growthEvents, 0u);
+    EXPECT_EQ(ser.stats().bytesCopied, 0u);
+}
+
+TEST(TestBinSer, SEGMENTED_STORAGE_BLOCK_CHECKSUM_OK) {
+    binser::SegmentedBinSer ser{};
+    std::string big(binser::polices::SegmentedStoragePolicy::segmentSize + 123, 'q');
+    std::string outBig;
+
+    ser.beginBlock();
+    ser.write(big);
+    ser.endBlock();
+
+    ASSERT_TRUE(ser.verifyBlock());
+    ser.read(outBig);
+
+    EXPECT_EQ(big, outBig);
+}
+
+#ifdef BINSER_HAS_IOVEC
+TEST(TestBinSer, SEGMENTED_STORAGE_IOVECS_OK) {
+    binser::SegmentedBinSer ser{};
+    std::vector<char> blob(2 * binser::polices::SegmentedStoragePolicy::segmentSize + 10, 'z');
+
+    ser.write(blob);
+    std::vector<iovec> iov = ser.iovecs();
+
+    std::size_t total = 0;
+    for (auto &&vec: iov) {
+        total += vec.iov_len;
+    }
+    EXPECT_EQ(iov.size(), 3u);
+    EXPECT_EQ(total, ser.size());
+}
+#endif
@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+#include <SocketTransport.h>
+#include <thread>
+
+enum class Side : std::uint8_t {
+    BUY, SELL
+};
+
+template<>
+struct binser::enum_range<Side> {
+    static constexpr Side max = Side::SELL;
+};
+
+class SocketPair {
+public:
+    SocketPair() {
+        EXPECT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+    }
+
+    ~SocketPair() {
+        ::close(fds[0]);
+        ::close(fds[1]);
+    }
+
+    int fds[2]{-1, -1};
+};
+
+TEST(TestBinSer, VECTORED_WRITER_REFERENCES_LARGE_PAYLOADS_OK) {
+    binser::VectoredWriter<> writer{64};
+    std::string small = "tiny";
+    std::string big(1000, 'b');
+    int n = 5;
+
+    writer.write(n);
+    writer.write(small);
+    writer.write(big);
+    writer.write(n);
+
+    std::vector<iovec> iov = writer.iovecs();
+
+    ASSERT_EQ(iov.size(), 3u);
+    EXPECT_EQ(iov[1].iov_base, big.data());
+    EXPECT_EQ(iov[1].iov_len, big.size());
+}
+
+TEST(TestBinSer, VECTORED_WRITER_SAME_WIRE_FORMAT_OK) {
+    binser::VectoredWriter<> writer{16};
+    binser::DynamicBinSer expected;
+    std::string str(100, 's');
+    std::vector<int> vec(50, 3);
+    std::vector<std::string> strs{"a", "b"};
+
+    writer.write(str);
+    writer.write(vec);
+    writer.write(strs);
+    expected.write(str);
+    expected.write(vec);
+    expected.write(strs);
+
+    std::string flat;
+    for (auto &&part: writer.iovecs()) {
+        flat.append(static_cast<const char *>(part.iov_base), part.iov_len);
+    }
+
+    EXPECT_EQ(flat, std::string(expected.data(), expected.size()));
+}
+
+TEST(TestBinSer, VECTORED_SOCKET_ROUNDTRIP_OK) {
+    SocketPair sockets;
+    std::string header = "header";
+    std::string blob(4 * 1024 * 1024, 'x');
+    std::vector<std::uint64_t> values(300'000);
+    for (std::size_t i = 0; i < values.size(); i++) {
+        values[i] = i * i;
+    }
+    int trailer = 99;
+
+    std::thread sender([&] {
+        binser::VectoredWriter<> writer;
+        writer.write(header);
+        writer.write(blob);
+        writer.write(values);
+        writer.write(trailer);
+        EXPECT_GT(writer.flush(sockets.fds[0]), 0);
+    });
+
+    binser::VectoredReader reader{sockets.fds[1]};
+    std::string outHeader;
+    std::string outBlob;
+    std::vector<std::uint64_t> outValues;
+    int outTrailer = 0;
+
+    EXPECT_TRUE(reader.read(outHeader));
+    EXPECT_TRUE(reader.read(outBlob));
+    EXPECT_TRUE(reader.read(outValues));
+    EXPECT_TRUE(reader.read(outTrailer));
+    sender.join();
+
+    EXPECT_EQ(header, outHeader);
+    EXPECT_EQ(blob, outBlob);
+    EXPECT_EQ(values, outValues);
+    EXPECT_EQ(trailer, outTrailer);
+}
+
+TEST(TestBinSer, VECTORED_SOCKET_OPTIONAL_OK) {
+    SocketPair sockets;
+    std::optional<int> some = 7;
+    std::optional<std::string> none;
+    int trailer = 99;
+
+    binser::VectoredWriter<> writer;
+    writer.write(some);
+    writer.write(none);
+    writer.write(trailer);
+    EXPECT_GT(writer.flush(sockets.fds[0]), 0);
+
+    binser::VectoredReader reader{sockets.fds[1]};
+    std::optional<int> outSome;
+    std::optional<std::string> outNone = "stale";
+    int outTrailer = 0;
+
+    EXPECT_TRUE(reader.read(outSome));
+    EXPECT_TRUE(reader.read(outNone));
+    EXPECT_TRUE(reader.read(outTrailer));
+    EXPECT_EQ(some, outSome);
+    EXPECT_EQ(none, outNone);
+    EXPECT_EQ(trailer, outTrailer);
+}
+
+TEST(TestBinSer, VECTORED_SOCKET_RANGED_ENUM_OUT_OF_RANGE_FAIL) {
+    SocketPair sockets;
+    binser::VectoredWriter<> writer;
+    writer.write(Side::SELL);
+    writer.write(std::uint8_t{2});
+    EXPECT_GT(writer.flush(sockets.fds[0]), 0);
+
+    binser::VectoredReader reader{sockets.fds[1]};
+    Side outSide = Side::BUY;
+    EXPECT_TRUE(reader.read(outSide));
+    EXPECT_EQ(outSide, Side::SELL);
+    EXPECT_FALSE(reader.read(outSide));
+    EXPECT_EQ(outSide, Side::SELL);
+}
+
+TEST(TestBinSer, VECTORED_SOCKET_LENGTH_PREFIX_DOES_NOT_PREALLOCATE) {
+    SocketPair sockets;
+    std::size_t claimed = 32 * 1024 * 1024;
+    std::string partial(1000, 'p');
+    ASSERT_EQ(::write(sockets.fds[0], &claimed, sizeof(claimed)), static_cast<ssize_t>(sizeof(claimed)));
+    ASSERT_EQ(::write(sockets.fds[0], partial.data(), partial.size()), static_cast<ssize_t>(partial.size()));
+    ::shutdown(sockets.fds[0], SHUT_WR);
+
+    binser::VectoredReader reader{sockets.fds[1]};
+    std::string out;
+
+    EXPECT_FALSE(reader.read(out));
+    EXPECT_LT(out.capacity(), claimed / 100);
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include <BinarySerializer.h>
+
+using CountingBinSer = binser::Serializer<binser::polices::DynamicStoragePolicy,
+        binser::polices::CountingStatsPolicy>;
+
+TEST(TestBinSer, NULL_STATS_POLICY_IS_FREE) {
+    EXPECT_FALSE(binser::polices::NullStatsPolicy::enabled);
+    EXPECT_TRUE(std::is_empty_v<binser::polices::NullStatsPolicy>);
+}
+
+TEST(TestBinSer, COUNTING_STATS_PER_TYPE_OK) {
+    CountingBinSer ser{};
+    int n = 7;
+    double d = 1.5;
+    std::string str = "abc";
+
+    ser.write(n);
+    ser.write(d);
+    ser.write(str);
+
+    int outN;
+    double outD;
+    std::string outStr;
+    ser.read(outN);
+    ser.read(outD);
+    ser.read(outStr);
+
+    auto &stats = ser.stats();
+    EXPECT_EQ(stats.forType<int>().bytesWritten, sizeof(int));
+    EXPECT_EQ(stats.forType<double>().bytesRead, sizeof(double));
+    EXPECT_EQ(stats.forType<char>().bytesWritten, str.size());
+    EXPECT_EQ(stats.forType<char>().writeCalls, 1u);
+    EXPECT_EQ(stats.bytesWritten, sizeof(int) + sizeof(double) + sizeof(std::size_t) + str.size());
+    EXPECT_EQ(stats.bytesWritten, stats.bytesRead);
+    EXPECT_EQ(stats.writeCalls, stats.readCalls);
+}
+
+TEST(TestBinSer, COUNTING_STATS_GROWTH_OK) {
+    CountingBinSer ser{};
+
+    for (int i = 0; i < 64; i++) {
+        ser.write(i);
+    }
+
+    auto &stats = ser.stats();
+    EXPECT_GT(stats.growthEvents, 0u);
+    EXPECT_GT(stats.bytesCopied, 0u);
+    EXPECT_LT(stats.bytesCopied, ser.capacity());
+}
+
+TEST(TestBinSer, COUNTING_STATS_SPAN_OK) {
+    CountingBinSer ser{};
+
+    {
+        auto span = ser.span("Person");
+        ser.write(1);
+    }
+
+    EXPECT_EQ(ser.stats().spans, 1u);
+}
+
+TEST(TestBinSer, COUNTING_STATS_BYTES_PER_SPAN_OK) {
+    CountingBinSer ser{};
+    std::vector<std::string> names{"alice", "bob"};
+
+    for (int i = 0; i < 3; i++) {
+        auto order = ser.span("Order");
+        ser.write(i);
+        {
+            auto person = ser.span("Person");
+            ser.write(names);
+        }
+    }
+    {
+        auto order = ser.span("Order");
+        int outI;
+        ser.read(outI);
+    }
+
+    auto &stats = ser.stats();
+    std::size_t personBytes = 3 * (3 * sizeof(std::size_t) + 5 + 3);
+    EXPECT_EQ(stats.perSpan["Order"].bytesWritten, 3 * sizeof(int));
+    EXPECT_EQ(stats.perSpan["Order"].bytesRead, sizeof(int));
+    EXPECT_EQ(stats.perSpan["Person"].bytesWritten, personBytes);
+    EXPECT_EQ(stats.bytesWritten, 3 * sizeof(int) + personBytes);
+}
@@ -33,4 +33,196 @@ TEST(TestBinSer, DYNAMIC_VECTOR_TEST_OK) {
     for (int i = 0; i < vec.size(); i++) {
         EXPECT_TRUE(vec[i] == outVec[i]);
     }
-}
\ No newline at end of file
+}
+
+TEST(TestBinSer, DYNAMIC_STACK_TEST_OK) {
+    binser::DynamicBinSer ser;
+
+    std::stack<std::string> stack;
+    stack.push("bottom");
+    stack.push("middle");
+    stack.push("top");
+    const auto &constStack = stack;
+    std::stack<std::string> outStack;
+
+    ser.write(constStack);
+    ser.read(outStack);
+
+    EXPECT_EQ(stack, outStack);
+    EXPECT_EQ(stack.size(), 3u);
+}
+
+TEST(TestBinSer, DYNAMIC_QUEUE_TEST_OK) {
+    binser::DynamicBinSer ser;
+
+    std::queue<int> queue;
+    for (int i = 0; i < 100; i++) {
+        queue.push(i);
+    }
+    std::queue<int> outQueue;
+
+    ser.write(queue);
+    ser.read(outQueue);
+
+    EXPECT_EQ(queue, outQueue);
+    EXPECT_EQ(outQueue.front(), 0);
+}
+
+TEST(TestBinSer, DYNAMIC_PRIORITY_QUEUE_TEST_OK) {
+    binser::DynamicBinSer ser;
+
+    std::priority_queue<int, std::vector<int>, std::greater<>> queue;
+    for (int i = 0; i < 100'000; i++) {
+        queue.push((i * 7919) % 100'003);
+    }
+    std::priority_queue<int, std::vector<int>, std::greater<>> outQueue;
+
+    ser.write(queue);
+    ser.read(outQueue);
+
+    ASSERT_EQ(queue.size(), outQueue.size());
+    while (!queue.empty()) {
+        EXPECT_EQ(queue.top(), outQueue.top());
+        queue.pop();
+        outQueue.pop();
+    }
+}
+
+struct DirectionalLess {
+    bool reverse{false};
+
+    bool operator()(int a, int b) const {
+        return reverse ? b < a : a < b;
+    }
+};
+
+TEST(TestBinSer, DYNAMIC_PRIORITY_QUEUE_STATEFUL_COMPARE_OK) {
+    binser::DynamicBinSer ser;
+
+    DirectionalLess compare{true};
+    std::priority_queue<int, std::vector<int>, DirectionalLess> queue{compare};
+    for (int i: {5, 1, 9, 3, 7}) {
+        queue.push(i);
+    }
+    std::priority_queue<int, std::vector<int>, DirectionalLess> outQueue{compare};
+
+    ser.write(queue);
+    ser.read(outQueue);
+
+    ASSERT_EQ(queue.size(), outQueue.size());
+    while (!queue.empty()) {
+        EXPECT_EQ(queue.top(), outQueue.top());
+        queue.pop();
+        outQueue.pop();
+    }
+}
+
+TEST(TestBinSer, DYNAMIC_MAP_TEST_OK) {
+    binser::DynamicBinSer ser;
+
+    std::map<int, std::string> map;
+    for (int i = 0; i < 1000; i++) {
+        map[i * 3] = std::to_string(i);
+    }
+    std::map<int, std::string> outMap;
+
+    ser.write(map);
+    ser.read(outMap);
+
+    EXPECT_EQ(map, outMap);
+}
+
+TEST(TestBinSer, DYNAMIC_UNORDERED_CONTAINERS_TEST_OK) {
+    binser::DynamicBinSer ser;
+
+    std::unordered_map<std::string, int> map{{"one", 1}, {"two", 2}, {"three", 3}};
+    std::unordered_set<int> set{5, 6, 7, 8};
+    std::unordered_map<std::string, int> outMap;
+    std::unordered_set<int> outSet;
+
+    ser.write(map);
+    ser.write(set);
+    ser.read(outMap);
+    ser.read(outSet);
+
+    EXPECT_EQ(map, outMap);
+    EXPECT_EQ(set, outSet);
+}
+
+TEST(TestBinSer, DYNAMIC_ORDERED_MULTI_CONTAINERS_TEST_OK) {
+    binser::DynamicBinSer ser;
+
+    std::set<std::string> set{"b", "a", "c"};
+    std::multimap<int, int> multimap{{1, 10}, {1, 11}, {2, 20}};
+    std::set<std::string> outSet;
+    std::multimap<int, int> outMultimap;
+
+    ser.write(set);
+    ser.write(multimap);
+    ser.read(outSet);
+    ser.read(outMultimap);
+
+    EXPECT_EQ(set, outSet);
+    EXPECT_EQ(multimap, outMultimap);
+}
+
+TEST(TestBinSer, DYNAMIC_SEQUENCE_CONTAINERS_TEST_OK) {
+    binser::DynamicBinSer ser;
+
+    std::deque<int> deque{1, 2, 3};
+    std::list<std::string> list{"x", "y"};
+    std::array<std::string, 2> arr{"first", "second"};
+    std::deque<int> outDeque;
+    std::list<std::string> outList;
+    std::array<std::string, 2> outArr;
+
+    ser.write(deque);
+    ser.write(list);
+    ser.write(arr);
+    ser.read(outDeque);
+    ser.read(outList);
+    ser.read(outArr);
+
+    EXPECT_EQ(deque, outDeque);
+    EXPECT_EQ(list, outList);
+    EXPECT_EQ(arr, outArr);
+}
+
+TEST(TestBinSer, DYNAMIC_PAIR_TUPLE_TEST_OK) {
+    binser::DynamicBinSer ser;
+
+    std::pair<int, std::string> pair{1, "one"};
+    std::tuple<double, std::string, std::vector<int>> tuple{2.5, "two", {1, 2}};
+    std::pair<int, std::string> outPair;
+    std::tuple<double, std::string, std::vector<int>> outTuple;
+
+    ser.write(pair);
+    ser.write(tuple);
+    ser.read(outPair);
+    ser.read(outTuple);
+
+    EXPECT_EQ(pair, outPair);
+    EXPECT_EQ(tuple, outTuple);
+}
+
+TEST(TestBinSer, DYNAMIC_OPTIONAL_VARIANT_TEST_OK) {
+    binser::DynamicBinSer ser;
+
+    std::optional<std::string> some{"value"};
+    std::optional<std::string> none;
+    std::variant<int, std::string> variant{std::string{"alt"}};
+    std::optional<std::string> outSome;
+    std::optional<std::string> outNone{"stale"};
+    std::variant<int, std::string> outVariant;
+
+    ser.write(some);
+    ser.write(none);
+    ser.write(variant);
+    ser.read(outSome);
+    ser.read(outNone);
+    ser.read(outVariant);
+
+    EXPECT_EQ(some, outSome);
+    EXPECT_EQ(none, outNone);
+    EXPECT_EQ(variant, outVariant);
+}